@@ -737,43 +737,111 @@ SPath CvAStar::GetCurrentPath() const
 
 //	--------------------------------------------------------------------------------
 /// check if a stored path is still viable
-bool CvAStar::VerifyPath(const SPath& path)
+/// the path is replayed node by node the same way the search links them, so stateful cost functions (unit movement) see the correct moves and turns.
+/// it only passes if every node still ends up with exactly the stored moves and turns and, if the path has a total cost, the replay costs no more than that.
+// private method - not threadsafe!
+bool CvAStar::VerifyPathWithCurrentConfiguration(const SPath& path)
 {
-	CvGuard guard(m_cs);
-
-	//set the right config
-	if (!Configure(path.sConfig.ePathType))
+	if (path.sConfig.ePathType != m_sData.ePathType)
 		return false;
 
 	//a single plot is always valid
 	if (path.vPlots.size()<2)
 		return true;
 
+	const SPathNode& kStart = path.vPlots.front();
+	const SPathNode& kDest = path.vPlots.back();
+	if (!IsInitialized(kStart.x, kStart.y, kDest.x, kDest.y))
+		return false;
+
+	//this is the version number for the node cache
+	m_iCurrentGenerationID++;
+	if (m_iCurrentGenerationID==0xFFFF)
+		m_iCurrentGenerationID = 1;
+
 	m_sData = path.sConfig;
+	m_iXstart = kStart.x;
+	m_iYstart = kStart.y;
+	m_iXdest = kDest.x;
+	m_iYdest = kDest.y;
+
+	Reset();
+
 	if (udInitializeFunc)
 		udInitializeFunc(m_sData,this);
 
-	bool bResult = true;
+	bool bResult = !udDestValid || udDestValid(m_iXdest, m_iYdest, m_sData, this);
+
+	CvAStarNode* current = &(m_ppaaNodes[m_iXstart][m_iYstart]);
+	if (bResult)
+	{
+		//track the nodes we touch in the closed list so the next Reset() cleans them up
+		current->clear();
+		current->m_eCvAStarListType = CVASTARLIST_CLOSED;
+		m_closedNodes.push_back(current);
+		NodeAdded(NULL, current, ASNC_INITIALADD);
+	}
+
 	int iKnownCost = 0;
-	for (size_t i=1; i<path.vPlots.size(); i++)
+	for (size_t i=1; bResult && i<path.vPlots.size(); i++)
 	{
-		CvAStarNode& current = m_ppaaNodes[ path.vPlots[i-1].x ][ path.vPlots[i-1].y ];
-		CvAStarNode& next = m_ppaaNodes[ path.vPlots[i].x ][ path.vPlots[i].y ];
+		const SPathNode& kNext = path.vPlots[i];
+		CvAStarNode* next = &(m_ppaaNodes[kNext.x][kNext.y]);
 
-		if ( udFunc(udValid, &current, &next, m_sData) )
+		//a proper path never visits a plot twice
+		if (next->m_eCvAStarListType != NO_CVASTARLIST)
 		{
-			iKnownCost += udFunc(udCost, &current, &next, m_sData);
-			if (iKnownCost > path.iTotalCost)
-			{
-				bResult = false;
-				break;
-			}
+			bResult = false;
+			break;
 		}
-		else
+
+		//same checks as in CreateChildren() / LinkChild()
+		if (!udFunc(udValid, current, next, m_sData))
+		{
+			bResult = false;
+			break;
+		}
+
+		if (current->m_iMoves == 0 && current->m_iTurns+1 > m_sData.iMaxTurns)
+		{
+			bResult = false;
+			break;
+		}
+
+		int iCost = udFunc(udCost, current, next, m_sData);
+		if (iCost < 0)
+		{
+			bResult = false;
+			break;
+		}
+
+		iKnownCost += iCost;
+		if (path.iTotalCost >= 0 && iKnownCost > path.iTotalCost)
 		{
 			bResult = false;
 			break;
 		}
+
+		if (m_sData.iMaxNormalizedDistance!= INT_MAX && iKnownCost > m_sData.iMaxNormalizedDistance*m_iBasicPlotCost)
+		{
+			bResult = false;
+			break;
+		}
+
+		next->m_pParent = current;
+		next->m_iKnownCost = iKnownCost;
+		next->m_eCvAStarListType = CVASTARLIST_CLOSED;
+		m_closedNodes.push_back(next);
+		NodeAdded(current, next, ASNC_NEWADD);
+
+		//if anything changed along the way (eg a voluntary stop is no longer needed), let a new search decide
+		if (next->m_iMoves != kNext.moves || next->m_iTurns != kNext.turns)
+		{
+			bResult = false;
+			break;
+		}
+
+		current = next;
 	}
 
 	if (udUninitializeFunc)
@@ -868,6 +936,7 @@ void UpdateNodeCacheData(CvAStarNode* node, const CvUnit* pUnit, const CvAStar*
 	kToNodeCacheData.bPlotVisibleToTeam = pPlot->isVisible(eUnitTeam);
 	kToNodeCacheData.bIsNonNativeDomain = pPlot->needsEmbarkation(pUnit); //not all water plots count as water ...
 	kToNodeCacheData.bIsValidRoute = pPlot->isValidRoute(pUnit);
+	kToNodeCacheData.iEnterCostValidMask = 0;
 
 	kToNodeCacheData.bContainsOtherFriendlyTeamCity = false;
 	kToNodeCacheData.bContainsEnemyCity = false;
@@ -904,6 +973,21 @@ void UpdateNodeCacheData(CvAStarNode* node, const CvUnit* pUnit, const CvAStar*
 		kToNodeCacheData.bContainsVisibleEnemyDefender = false;
 	}
 
+	//the units around us don't move during a pathfinding operation, so each plot needs to be looked at only once
+	//the embarkation dependent part is resolved per move in PathCost
+	kToNodeCacheData.iZOCSources = CvUnitMovement::ZOC_SOURCE_NONE;
+	if (!finder->HaveFlag(CvUnit::MOVEFLAG_IGNORE_ZOC) && !pUnit->IsIgnoreZOC() && GC.getZONE_OF_CONTROL_ENABLED() > 0)
+	{
+		if (finder->HaveFlag(CvUnit::MOVEFLAG_SELECTIVE_ZOC))
+		{
+			const set<int>& ignoreEnemies = finder->GetData().plotsToIgnoreForZOC;
+			if (ignoreEnemies.find(pPlot->GetPlotIndex()) == ignoreEnemies.end())
+				kToNodeCacheData.iZOCSources = (unsigned char)CvUnitMovement::GetZOCSources(pUnit, pPlot, true);
+		}
+		else
+			kToNodeCacheData.iZOCSources = (unsigned char)CvUnitMovement::GetZOCSources(pUnit, pPlot, false);
+	}
+
 	//ignore this unit when counting!
 	bool bIsInitialNode = pUnit->at(node->m_iX,node->m_iY);
 	int iNumUnits = pPlot->getMaxFriendlyUnitsOfType(pUnit) - (bIsInitialNode ? 1 : 0);
@@ -1214,7 +1298,7 @@ int PathEndTurnCost(CvPlot* pToPlot, const CvPathNodeCacheData& kToNodeCacheData
 
 //	--------------------------------------------------------------------------------
 /// Standard path finder - compute cost of a move
-int PathCost(const CvAStarNode* parent, const CvAStarNode* node, const SPathFinderUserData& data, CvAStar* finder)
+int PathCost(const CvAStarNode* parent, const CvAStarNode* node, const SPathFinderUserData&, CvAStar* finder)
 {
 	int iStartMoves = parent->m_iMoves;
 	int iTurns = parent->m_iTurns;
@@ -1263,15 +1347,50 @@ int PathCost(const CvAStarNode* parent, const CvAStarNode* node, const SPathFind
 	{
 		int iMaxMoves = pUnitDataCache->baseMoves(pToPlot->getDomain())*GC.getMOVE_DENOMINATOR(); //important, use the cached value
 
+		int iMoveDir = directionXY(pFromPlot,pToPlot);
+
+		bool bSlowedByZOC = false;
 		if (bCheckZOC)
 		{
-			if (finder->HaveFlag(CvUnit::MOVEFLAG_SELECTIVE_ZOC))
-				iMovementCost = CvUnitMovement::MovementCostSelectiveZOC(pUnit, pFromPlot, pToPlot, iStartMoves, iMaxMoves, data.plotsToIgnoreForZOC);
-			else
-				iMovementCost = CvUnitMovement::MovementCost(pUnit, pFromPlot, pToPlot, iStartMoves, iMaxMoves);
+			//only the two plots flanking the move can exert zoc. their cached classification already honors the selective zoc flag
+			CvAStarNode* aFlankNodes[2] = { parent->m_apNeighbors[(iMoveDir + 1) % 6], parent->m_apNeighbors[(iMoveDir + 5) % 6] };
+			for (int iI = 0; iI < 2 && !bSlowedByZOC; iI++)
+			{
+				if (!aFlankNodes[iI])
+					continue;
+
+				UpdateNodeCacheData(aFlankNodes[iI], pUnit, finder);
+				int iSources = aFlankNodes[iI]->m_kCostCacheData.iZOCSources;
+				if (iSources != CvUnitMovement::ZOC_SOURCE_NONE)
+					bSlowedByZOC = CvUnitMovement::IsSlowedByZOCSources(iSources, kFromNodeCacheData.bIsNonNativeDomain, kToNodeCacheData.bIsNonNativeDomain);
+			}
 		}
+
+		if (bSlowedByZOC)
+			iMovementCost = iStartMoves;
 		else
-			iMovementCost = CvUnitMovement::MovementCostNoZOC(pUnit, pFromPlot, pToPlot, iStartMoves, iMaxMoves);
+		{
+			//the same edge is evaluated repeatedly during one pathfinding operation (second layer, parent updates)
+			//but its base cost only depends on the unit and the two plots, so remember it on the base node of the target plot
+			int iBaseCost = 0;
+			CvAStarNode* pToBaseNode = parent->m_apNeighbors[iMoveDir];
+			if (pToBaseNode && pToBaseNode->m_iX == iToPlotX && pToBaseNode->m_iY == iToPlotY)
+			{
+				UpdateNodeCacheData(pToBaseNode, pUnit, finder);
+				CvPathNodeCacheData& kEdgeCacheData = pToBaseNode->m_kCostCacheData;
+				int iFromDir = (iMoveDir + 3) % 6;
+				if (!(kEdgeCacheData.iEnterCostValidMask & (1 << iFromDir)))
+				{
+					kEdgeCacheData.aiEnterCost[iFromDir] = CvUnitMovement::GetCostsForMove(pUnit, pFromPlot, pToPlot);
+					kEdgeCacheData.iEnterCostValidMask |= (1 << iFromDir);
+				}
+				iBaseCost = kEdgeCacheData.aiEnterCost[iFromDir];
+			}
+			else
+				iBaseCost = CvUnitMovement::GetCostsForMove(pUnit, pFromPlot, pToPlot);
+
+			iMovementCost = CvUnitMovement::LimitMovementCost(iBaseCost, iStartMoves, iMaxMoves);
+		}
 	}
 
 	// how much is left over?
@@ -2314,6 +2433,74 @@ bool CvStepFinder::AddStopNodeIfRequired(const CvAStarNode*, const CvAStarNode*)
 	return false;
 }
 
+//	--------------------------------------------------------------------------------
+CvStepFinder::CvStepFinder() : m_iPathCacheTurn(-1)
+{
+}
+
+//	--------------------------------------------------------------------------------
+void CvStepFinder::Initialize(int iColumns, int iRows, bool bWrapX, bool bWrapY)
+{
+	//new map or loaded game, nothing we remember is valid anymore
+	ClearPathCache();
+
+	CvPathFinder::Initialize(iColumns, iRows, bWrapX, bWrapY);
+}
+
+//	--------------------------------------------------------------------------------
+void CvStepFinder::ClearPathCache()
+{
+	CvGuard guard(m_cs);
+
+	m_pathCache.clear();
+	m_iPathCacheTurn = -1;
+}
+
+//	--------------------------------------------------------------------------------
+/// Operational AI asks for the same generic paths over and over during a turn, so remember the results.
+/// Only the plain generic path types are cached, they don't depend on units or movement points.
+SPath CvStepFinder::GetPath(int iXstart, int iYstart, int iXdest, int iYdest, const SPathFinderUserData& data)
+{
+	bool bCacheable = false;
+	switch (data.ePathType)
+	{
+	case PT_GENERIC_SAME_AREA:
+	case PT_GENERIC_ANY_AREA:
+	case PT_GENERIC_SAME_AREA_WIDE:
+	case PT_GENERIC_ANY_AREA_WIDE:
+		bCacheable = (data.iMaxTurns == INT_MAX && data.iMaxNormalizedDistance == INT_MAX && data.plotsToIgnoreForZOC.empty());
+		break;
+	default:
+		break;
+	}
+
+	if (!bCacheable || !isValid(iXstart, iYstart) || !isValid(iXdest, iYdest))
+		return CvPathFinder::GetPath(iXstart, iYstart, iXdest, iYdest, data);
+
+	//make sure we don't call this from dll and lua at the same time
+	CvGuard guard(m_cs);
+
+	int iGameTurn = GC.getGame().getGameTurn();
+	if (m_iPathCacheTurn != iGameTurn)
+	{
+		m_pathCache.clear();
+		m_iPathCacheTurn = iGameTurn;
+	}
+
+	SPathCacheKey key(GC.getMap().plotNum(iXstart, iYstart), GC.getMap().plotNum(iXdest, iYdest), data);
+	std::map<SPathCacheKey,SPath>::iterator it = m_pathCache.find(key);
+	if (it != m_pathCache.end())
+		return it->second;
+
+	//keep the memory bounded, a turn rarely needs this many distinct queries
+	if (m_pathCache.size() > 4096)
+		m_pathCache.clear();
+
+	SPath path = CvPathFinder::GetPath(iXstart, iYstart, iXdest, iYdest, data);
+	m_pathCache[key] = path;
+	return path;
+}
+
 //////////////////////////////////////////////////////////////////////////
 // CvPathFinder convenience functions
 //////////////////////////////////////////////////////////////////////////
@@ -2416,6 +2603,20 @@ SPath CvPathFinder::GetPath(const CvPlot* pStartPlot, const CvPlot* pEndPlot, co
 	return GetPath(pStartPlot->getX(), pStartPlot->getY(), pEndPlot->getX(), pEndPlot->getY(), data);
 }
 
+//	--------------------------------------------------------------------------------
+/// configure the pathfinder and check if a stored path can still be followed as it is
+///	atomic call, should be threadsafe
+bool CvPathFinder::IsPathStillValid(const SPath& path)
+{
+	//make sure we don't call this from dll and lua at the same time
+	CvGuard guard(m_cs);
+
+	if (!Configure(path.sConfig.ePathType))
+		return false;
+
+	return CvAStar::VerifyPathWithCurrentConfiguration(path);
+}
+
 //	--------------------------------------------------------------------------------
 /// Check for existence of path between two points
 bool CvPathFinder::DoesPathExist(int iXstart, int iYstart, int iXdest, int iYdest, const SPathFinderUserData& data)
@@ -66,8 +66,8 @@ public:
 	// Generates a path
 	bool FindPathWithCurrentConfiguration(int iXstart, int iYstart, int iXdest, int iYdest, const SPathFinderUserData& data);
 
-	// Verifies if the given path is still valid
-	bool VerifyPath(const SPath& path);
+	// Checks if a stored path is still valid
+	bool VerifyPathWithCurrentConfiguration(const SPath& path);
 
 	// Get the result
 	SPath GetCurrentPath() const;
@@ -358,6 +358,7 @@ public:
 	virtual ReachablePlots GetPlotsInReach(int iXstart, int iYstart, const SPathFinderUserData& data);
 	virtual ReachablePlots GetPlotsInReach(const CvPlot* pStartPlot, const SPathFinderUserData& data);
 	virtual map<CvPlot*,SPath> GetMultiplePaths(const CvPlot* pStartPlot, vector<CvPlot*> vDestPlots, const SPathFinderUserData& data);
+	virtual bool IsPathStillValid(const SPath& path);
 	virtual bool DestinationReached(int iToX, int iToY) const;
 };
 
@@ -366,12 +367,50 @@ public:
 //-------------------------------------------------------------------------------------------------
 class CvStepFinder : public CvPathFinder
 {
+public:
+	CvStepFinder();
+
+	virtual void Initialize(int iColumns, int iRows, bool bWrapX, bool bWrapY);
+
+	//generic paths are cached for the current turn, other path types are passed through
+	using CvPathFinder::GetPath;
+	virtual SPath GetPath(int iXstart, int iYstart, int iXdest, int iYdest, const SPathFinderUserData& data);
+
+	//call this when anything the generic path types depend on changes (ownership, routes, terrain, war, borders)
+	void ClearPathCache();
+
+private:
 	virtual bool CanEndTurnAtNode(const CvAStarNode* temp) const;
 	virtual bool AddStopNodeIfRequired(const CvAStarNode* current, const CvAStarNode* next);
 	virtual void NodeAdded(CvAStarNode* parent, CvAStarNode* node, CvAStarNodeAddOp operation);
 
 protected:
 	virtual bool Configure(PathType ePathType);
+
+	struct SPathCacheKey
+	{
+		SPathCacheKey(int iStart, int iDest, const SPathFinderUserData& data) : 
+			iStartIndex(iStart), iDestIndex(iDest), ePathType(data.ePathType), iFlags(data.iFlags), ePlayer(data.ePlayer), iTypeParameter(data.iTypeParameter) {}
+
+		bool operator<(const SPathCacheKey& rhs) const
+		{
+			if (iStartIndex != rhs.iStartIndex) return iStartIndex < rhs.iStartIndex;
+			if (iDestIndex != rhs.iDestIndex) return iDestIndex < rhs.iDestIndex;
+			if (ePathType != rhs.ePathType) return ePathType < rhs.ePathType;
+			if (iFlags != rhs.iFlags) return iFlags < rhs.iFlags;
+			if (ePlayer != rhs.ePlayer) return ePlayer < rhs.ePlayer;
+			return iTypeParameter < rhs.iTypeParameter;
+		}
+
+		int iStartIndex, iDestIndex;
+		PathType ePathType;
+		int iFlags;
+		PlayerTypes ePlayer;
+		int iTypeParameter;
+	};
+
+	std::map<SPathCacheKey,SPath> m_pathCache;
+	int m_iPathCacheTurn;
 };
 
 //-------------------------------------------------------------------------------------------------
@@ -89,6 +89,13 @@ struct CvPathNodeCacheData
 	bool bFriendlyUnitLimitReached:1;
 	bool bIsValidRoute:1;
 
+	//zone of control exerted by this plot on the moving unit (see CvUnitMovement::ZOCSourceFlags)
+	unsigned char iZOCSources;
+
+	//base cost for entering this plot from each neighbor (indexed by the direction of the neighbor), filled lazily by the cost function
+	unsigned char iEnterCostValidMask;
+	int aiEnterCost[6];
+
 	int iMoveFlags;
 
 	//tells when to update the cache ...
@@ -167,15 +174,17 @@ struct SPathFinderUserData
 struct SPathNode
 {
 	short x,y,turns,moves;
+	int knownCost; //cumulative path cost up to this node
 
 	//constructor
-	SPathNode() : x(-1),y(-1),turns(0),moves(0) {}
+	SPathNode() : x(-1),y(-1),turns(0),moves(0),knownCost(0) {}
 	SPathNode(CvAStarNode* p)
 	{
 		x = p ? p->m_iX : -1;
 		y = p ? p->m_iY : -1;
 		turns = p ? p->m_iTurns : 0;
 		moves = p ? p->m_iMoves : 0;
+		knownCost = p ? p->m_iKnownCost : 0;
 	}
 
 	bool operator==(const SPathNode& other)
@@ -274,6 +283,7 @@ public:
 		m_iMoves = 0;
 		m_iTurns = 0;
 		m_iFlags = 0;
+		m_iKnownCost = 0;
 	}
 
 	enum Flags
@@ -290,6 +300,7 @@ public:
 	int m_iMoves;
 	int m_iTurns;
 	int m_iFlags;
+	int m_iKnownCost;         // Cumulative path cost up to here, as of when the path was generated
 	short m_iX, m_iY;         // Coordinate position
 
 	bool GetFlag(int eFlag) const { return (m_iFlags & eFlag) != 0; }
@@ -303,6 +314,7 @@ public:
 		m_iTurns = rhs.turns;
 		m_iMoves = rhs.moves;
 		m_iFlags = 0;
+		m_iKnownCost = rhs.knownCost;
 		return *this;
 	}
 };
@@ -139,7 +139,7 @@ void CvBarbarians::DoCampActivationNotice(CvPlot* pPlot)
 	CvGame& kGame = GC.getGame();
 	// Default to between 8 and 12 turns per spawn
 #if defined(MOD_CORE_REDUCE_RANDOMNESS)
-	int iNumTurnsToSpawn = 7 + kGame.getSmallFakeRandNum(10,*pPlot);
+	int iNumTurnsToSpawn = 7 + kGame.getKeyedRandNum(10, RAND_STREAM_BARBARIANS, BARBARIAN_PLAYER, pPlot->GetPlotIndex());
 #else
 	int iNumTurnsToSpawn = 8 + kGame.getJonRandNum(5, "Barb Spawn Rand call");
 #endif
@@ -204,7 +204,7 @@ void CvBarbarians::DoCityActivationNotice(CvPlot* pPlot)
 	// Default to between 8 and 12 turns per spawn
 	//bumped a bit - too many barbs gets annoying.
 #if defined(MOD_CORE_REDUCE_RANDOMNESS)
-	int iNumTurnsToSpawn = 7 + kGame.getSmallFakeRandNum(10,*pPlot);
+	int iNumTurnsToSpawn = 7 + kGame.getKeyedRandNum(10, RAND_STREAM_BARBARIANS, BARBARIAN_PLAYER, pPlot->GetPlotIndex());
 #else
 	int iNumTurnsToSpawn = 15 + kGame.getJonRandNum(5, "Barb Spawn Rand call");
 #endif
@@ -470,17 +470,14 @@ void CvBarbarians::DoCamps()
 		CvMap& kMap = GC.getMap();
 		std::vector<CvPlot*> vCoastalPlots,vAllPlots;
 
+		// See how many camps we already have
+		iNumCampsInExistence = (int)kMap.GetPlotsWithImprovement(eCamp).size();
+
 		// Figure out how many Nonvisible tiles we have to base # of camps to spawn on
 		for(int iI = 0; iI < kMap.numPlots(); iI++)
 		{
 			CvPlot* pLoopPlot = kMap.plotByIndexUnchecked(iI);
 
-			// See how many camps we already have
-			if(pLoopPlot->getImprovementType() == eCamp)
-			{
-				iNumCampsInExistence++;
-			}
-
 			//Discount all owned plots.
 			if (pLoopPlot->getOwner() != NO_PLAYER)
 				continue;
@@ -517,7 +514,7 @@ void CvBarbarians::DoCamps()
 			if (vAllPlots.size()>1)
 			{
 				//do one iteration of a fisher-yates shuffle
-				int iSwap = kGame.getSmallFakeRandNum( vAllPlots.size(), *pLoopPlot);
+				int iSwap = kGame.getKeyedRandNum(vAllPlots.size(), RAND_STREAM_BARBARIANS, BARBARIAN_PLAYER, pLoopPlot->GetPlotIndex());
 				std::swap(vAllPlots[iSwap],vAllPlots.back());
 			}
 #endif
@@ -529,8 +526,8 @@ void CvBarbarians::DoCamps()
 #if defined(MOD_CORE_REDUCE_RANDOMNESS)
 				if (vCoastalPlots.size()>1)
 				{
-					//do one iteration of a fisher-yates shuffle
-					int iSwap = kGame.getSmallFakeRandNum( vCoastalPlots.size(), *pLoopPlot);
+					//do one iteration of a fisher-yates shuffle, keyed apart from the shuffle of all plots above
+					int iSwap = kGame.getKeyedRandNum(vCoastalPlots.size(), RAND_STREAM_BARBARIANS, BARBARIAN_PLAYER, kMap.numPlots() + pLoopPlot->GetPlotIndex());
 					std::swap(vCoastalPlots[iSwap],vCoastalPlots.back());
 				}
 #endif
@@ -554,7 +551,8 @@ void CvBarbarians::DoCamps()
 			else
 			{
 #if defined(MOD_CORE_REDUCE_RANDOMNESS)
-				if (kGame.getSmallFakeRandNum(GC.getBARBARIAN_CAMP_ODDS_OF_NEW_CAMP_SPAWNING(), iNumValidCampPlots) == 0)
+				//the rolls below that are not about a single plot use negative keys, so they never collide with the shuffles
+				if (kGame.getKeyedRandNum(GC.getBARBARIAN_CAMP_ODDS_OF_NEW_CAMP_SPAWNING(), RAND_STREAM_BARBARIANS, BARBARIAN_PLAYER, -1) == 0)
 #else
 				if(kGame.getJonRandNum(/*2*/ GC.getBARBARIAN_CAMP_ODDS_OF_NEW_CAMP_SPAWNING(), "Random roll to see if Barb Camp spawns this turn") > 0)
 #endif
@@ -589,8 +587,8 @@ void CvBarbarians::DoCamps()
 
 				// Do a random roll to bias in favor of Coastal land Tiles so that the Barbs will spawn Boats :) - required 1/6 of the time
 #if defined(MOD_CORE_REDUCE_RANDOMNESS)
-				// make sure we have suitable coastal plots!
-				bool bWantsCoastal = kGame.getSmallFakeRandNum(/*6*/ GC.getBARBARIAN_CAMP_COASTAL_SPAWN_ROLL(), iNumValidCampPlots) == 0 ? !vCoastalPlots.empty() : false;
+				// make sure we have suitable coastal plots! each attempt rolls with its own keys
+				bool bWantsCoastal = kGame.getKeyedRandNum(/*6*/ GC.getBARBARIAN_CAMP_COASTAL_SPAWN_ROLL(), RAND_STREAM_BARBARIANS, BARBARIAN_PLAYER, -2 * iCount) == 0 ? !vCoastalPlots.empty() : false;
 
 				// if we don't have any valid plots left at all, then bail
 				if (vAllPlots.empty())
@@ -598,7 +596,7 @@ void CvBarbarians::DoCamps()
 
 				std::vector<CvPlot*>& vRelevantPlots = bWantsCoastal ? vCoastalPlots : vAllPlots;
 
-				int iPlotIndex = kGame.getSmallFakeRandNum( min(9u, vRelevantPlots.size()), (int)vRelevantPlots.size() );
+				int iPlotIndex = kGame.getKeyedRandNum(min(9u, vRelevantPlots.size()), RAND_STREAM_BARBARIANS, BARBARIAN_PLAYER, -2 * iCount - 1);
 #else
 				bool bWantsCoastal = kGame.getJonRandNum(/*6*/ GC.getBARBARIAN_CAMP_COASTAL_SPAWN_ROLL(), "Barb Camp Plot-Finding Roll - Coastal Bias") == 0 ? true : false;
 				int iPlotIndex = kGame.getJonRandNum( bWantsCoastal ? vCoastalPlots.size() : vAllPlots.size(), "Barb Camp Plot-Finding Roll");
@@ -919,11 +917,18 @@ void CvBarbarians::DoUnits()
 	}
 
 	ImprovementTypes eCamp = (ImprovementTypes)GC.getBARBARIAN_CAMP_IMPROVEMENT();
+	if(eCamp == NO_IMPROVEMENT)
+	{
+		return;
+	}
 
 	CvMap& kMap = GC.getMap();
-	for(int iPlotLoop = 0; iPlotLoop < kMap.numPlots(); iPlotLoop++)
+
+	// copy, spawning may change the map
+	std::vector<int> vCampPlots = kMap.GetPlotsWithImprovement(eCamp);
+	for(size_t iCampLoop = 0; iCampLoop < vCampPlots.size(); iCampLoop++)
 	{
-		CvPlot* pLoopPlot = kMap.plotByIndexUnchecked(iPlotLoop);
+		CvPlot* pLoopPlot = kMap.plotByIndexUnchecked(vCampPlots[iCampLoop]);
 
 		// Found a Camp to spawn near
 		if (pLoopPlot && pLoopPlot->getImprovementType() == eCamp)
@@ -1070,7 +1075,7 @@ void CvBarbarians::DoSpawnBarbarianUnit(CvPlot* pPlot, bool bIgnoreMaxBarbarians
 		if(vBalidBarbSpawnPlots.size() > 0)
 		{
 #if defined(MOD_CORE_REDUCE_RANDOMNESS)
-			int iIndex = kGame.getSmallFakeRandNum(vBalidBarbSpawnPlots.size(),*pPlot);
+			int iIndex = kGame.getKeyedRandNum(vBalidBarbSpawnPlots.size(), RAND_STREAM_BARBARIANS, BARBARIAN_PLAYER, pPlot->GetPlotIndex());
 #else
 			int iIndex = kGame.getJonRandNum(vBalidBarbSpawnPlots.size(), "Barb Unit Location Spawn Roll");
 #endif
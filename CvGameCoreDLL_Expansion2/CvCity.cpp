@@ -7611,12 +7611,12 @@ bool CvCity::canTrain(UnitTypes eUnit, bool bContinue, bool bTestVisible, bool b
 	}
 #if defined(MOD_BALANCE_CORE)
 	// If Zulu Player has this trait and Pikeman are an immediate upgrade to Impi, let's not let player exploit lower production cost of pikeman->impi. So, let's make it immediately obsolete.
-	CvUnitEntry& pUnitInfo = *pkUnitEntry;
-	const UnitClassTypes eUnitClass = (UnitClassTypes) pUnitInfo.GetUnitClassType();
-	UnitClassTypes ePikemanClass = (UnitClassTypes)GC.getInfoTypeForString("UNITCLASS_PIKEMAN");
-	UnitTypes eZuluImpi = (UnitTypes)GC.getInfoTypeForString("UNIT_ZULU_IMPI");
-	if(&pUnitInfo != NULL && GET_PLAYER(getOwner()).GetPlayerTraits()->IsFreeZuluPikemanToImpi())
+	// (string lookups only happen for the one player with the trait)
+	if(GET_PLAYER(getOwner()).GetPlayerTraits()->IsFreeZuluPikemanToImpi())
 	{
+		const UnitClassTypes eUnitClass = (UnitClassTypes) pkUnitEntry->GetUnitClassType();
+		UnitClassTypes ePikemanClass = (UnitClassTypes)GC.getInfoTypeForString("UNITCLASS_PIKEMAN");
+		UnitTypes eZuluImpi = (UnitTypes)GC.getInfoTypeForString("UNIT_ZULU_IMPI");
 		if(eUnitClass != NO_UNITCLASS && (eUnitClass == ePikemanClass) && GET_PLAYER(getOwner()).canTrain(eZuluImpi, false, false, true))
 		{
 			return false;
@@ -9368,7 +9368,7 @@ void CvCity::DoSeedResourceDemandedCountdown()
 
 	int iRand = /*10*/ GC.getRESOURCE_DEMAND_COUNTDOWN_RAND();
 #if defined(MOD_CORE_REDUCE_RANDOMNESS)
-	iNumTurns += GC.getGame().getSmallFakeRandNum(iRand, getPopulation());
+	iNumTurns += GC.getGame().getKeyedRandNum(iRand, RAND_STREAM_CITIES, getOwner(), getPopulation());
 #else
 	iNumTurns += GC.getGame().getJonRandNum(iRand, "City Resource demanded rand.");
 #endif
@@ -14277,6 +14277,10 @@ void CvCity::processBuilding(BuildingTypes eBuilding, int iChange, bool bFirst,
 		owningPlayer.changeBuildingClassCount(eBuildingClass, iChange);
 	}
 
+	// recount rather than add iChange, so we agree with the rebuild after loading
+	if(pBuildingInfo->NullifyInfluenceModifier())
+		owningPlayer.UpdateNumInfluenceNullifyingBuildings();
+
 	UpdateReligion(GetCityReligions()->GetReligiousMajority());
 	GET_PLAYER(getOwner()).CalculateNetHappiness();
 #if defined(MOD_BALANCE_CORE)
@@ -21162,25 +21166,24 @@ int CvCity::getBaseYieldRateModifier(YieldTypes eIndex, int iExtra, CvString* to
 	if(toolTipSink)
 		GC.getGame().BuildProdModHelpText(toolTipSink, "TXT_KEY_PRODMOD_YIELD", iTempMod);
 
-	CvPlot* pCityPlot = plot();
-	for(int iUnitLoop = 0; iUnitLoop < pCityPlot->getNumUnits(); iUnitLoop++)
+	// only the few promotions which modify this yield need to be checked on the units in the city
+	const std::vector<PromotionTypes>& aYieldPromotions = GC.GetGamePromotions()->GetPromotionsWithYieldModifier(eIndex);
+	if(!aYieldPromotions.empty())
 	{
-		for(int iI = 0; iI < GC.getNumPromotionInfos(); iI++)
+		CvPlot* pCityPlot = plot();
+		for(int iUnitLoop = 0; iUnitLoop < pCityPlot->getNumUnits(); iUnitLoop++)
 		{
-			const PromotionTypes eLoopPromotion = static_cast<PromotionTypes>(iI);
-			CvPromotionEntry* pkPromotionInfo = GC.getPromotionInfo(eLoopPromotion);
-			if(pkPromotionInfo != NULL)
+			CvUnit* pLoopUnit = pCityPlot->getUnitByIndex(iUnitLoop);
+			for(size_t iI = 0; iI < aYieldPromotions.size(); iI++)
 			{
-				if(pkPromotionInfo->GetYieldModifier(eIndex) > 0)
+				const PromotionTypes eLoopPromotion = aYieldPromotions[iI];
+				if(pLoopUnit->isHasPromotion(eLoopPromotion))
 				{
-					if(pCityPlot->getUnitByIndex(iUnitLoop)->isHasPromotion(eLoopPromotion))
+					iTempMod = GC.getPromotionInfo(eLoopPromotion)->GetYieldModifier(eIndex);
+					iModifier += iTempMod;
+					if(toolTipSink && iTempMod)
 					{
-						iTempMod = pkPromotionInfo->GetYieldModifier(eIndex);
-						iModifier += iTempMod;
-						if(toolTipSink && iTempMod)
-						{
-							GC.getGame().BuildProdModHelpText(toolTipSink, "TXT_KEY_PRODMOD_YIELD_UNITPROMOTION", iTempMod);
-						}
+						GC.getGame().BuildProdModHelpText(toolTipSink, "TXT_KEY_PRODMOD_YIELD_UNITPROMOTION", iTempMod);
 					}
 				}
 			}
@@ -23077,7 +23080,7 @@ void CvCity::DoBarbIncursion()
 			return;
 
 		int iCityStrength = getStrengthValue(true);
-		iCityStrength += (GC.getGame().getSmallFakeRandNum(10, getOwner()) * 10);
+		iCityStrength += (GC.getGame().getKeyedRandNum(10, RAND_STREAM_CITIES, getOwner(), getOwner()) * 10);
 		iCityStrength /= 100;
 
 		CvPlot* pLoopPlot;
@@ -23091,14 +23094,14 @@ void CvCity::DoBarbIncursion()
 				if(pUnit != NULL && pUnit->isBarbarian() && pUnit->IsCombatUnit())
 				{			
 					int iBarbStrength = pUnit->isRanged() ? (pUnit->GetBaseRangedCombatStrength() * 4) : (pUnit->GetBaseCombatStrength() * 4);
-					iBarbStrength += GC.getGame().getSmallFakeRandNum(10, pUnit->GetID()) * 18;
+					iBarbStrength += GC.getGame().getKeyedRandNum(10, RAND_STREAM_CITIES, getOwner(), pUnit->GetID()) * 18;
 					if(iBarbStrength > iCityStrength)
 					{
 						int iTheft = (iBarbStrength - iCityStrength);
 
 						if(iTheft > 0)
 						{
-							int iYield = GC.getGame().getSmallFakeRandNum(10, pUnit->GetID());
+							int iYield = GC.getGame().getKeyedRandNum(10, RAND_STREAM_CITIES, getOwner(), pUnit->GetID());
 							if(iYield <= 2)
 							{
 								int iGold = ((getBaseYieldRate(YIELD_GOLD) * iTheft) / 100);
@@ -24770,7 +24773,7 @@ CvPlot* CvCity::GetNextBuyablePlot(bool bForPurchase)
 	if (aiPlotList.empty())
 		return NULL;
 
-	int iPickedIndex = GC.getGame().getSmallFakeRandNum( aiPlotList.size(), *plot());
+	int iPickedIndex = GC.getGame().getKeyedRandNum(aiPlotList.size(), RAND_STREAM_CITIES, getOwner(), plot()->GetPlotIndex());
 	return GC.getMap().plotByIndex(aiPlotList[iPickedIndex]);
 }
 
@@ -26797,7 +26800,7 @@ CvPlot* CvCity::GetPlotForNewUnit(UnitTypes eUnitType) const
 		{0, 5, 4, 2, 1, 3, 6},
 		{0, 3, 6, 4, 1, 2, 5},
 		{0, 1, 2, 4, 5, 6, 3}};
-	int iShuffleType = GC.getGame().getSmallFakeRandNum(3, *plot());
+	int iShuffleType = GC.getGame().getKeyedRandNum(3, RAND_STREAM_CITIES, getOwner(), plot()->GetPlotIndex());
 	
 	//check city plot and adjacent plots
 	vector<CvPlot*> validChoices;
@@ -29495,7 +29498,7 @@ int CvCity::rangeCombatDamage(const CvUnit* pDefender, CvCity* pCity, bool bIncl
 	{
 		if (isBarbarian())
 		{
-			iAttackerRoll = GC.getGame().getSmallFakeRandNum(10, GetID()) * 120;
+			iAttackerRoll = GC.getGame().getKeyedRandNum(10, RAND_STREAM_CITIES, getOwner(), GetID()) * 120;
 		}
 		else
 		{
@@ -2524,6 +2524,11 @@ void CvCityCitizens::DoReallocateCitizens()
 	DoValidateForcedWorkingPlots();
 #endif
 
+	// Every citizen moved below asks for a happiness update; do it once at the end instead
+	// note that IsAvoidGrowth() therefore judges every placement by the empire's happiness from before the reshuffle, not by a half-finished assignment
+	CvPlayer& kOwner = GET_PLAYER(GetCity()->getOwner());
+	kOwner.BeginHappinessUpdateBatch();
+
 	// Remove all of the allocated guys
 	int iNumCitizensToRemove = GetNumCitizensWorkingPlots();
 	for(int iWorkerLoop = 0; iWorkerLoop < iNumCitizensToRemove; iWorkerLoop++)
@@ -2608,7 +2613,8 @@ void CvCityCitizens::DoReallocateCitizens()
 	GetCity()->GetCityCulture()->CalculateBaseTourismBeforeModifiers();
 	GetCity()->GetCityCulture()->CalculateBaseTourism();
 #endif
-	GET_PLAYER(GetCity()->getOwner()).CalculateNetHappiness();
+	kOwner.CalculateNetHappiness();
+	kOwner.EndHappinessUpdateBatch();
 }
 
 
@@ -3581,6 +3587,9 @@ void CvCityCitizens::DoRemoveAllSpecialistsFromBuilding(BuildingTypes eBuilding,
 
 	m_aiNumForcedSpecialistsInBuilding[eBuilding] = 0;
 
+	CvPlayer& kOwner = GET_PLAYER(GetCity()->getOwner());
+	kOwner.BeginHappinessUpdateBatch();
+
 	// Pick the worst to remove
 	for(int iAssignedLoop = 0; iAssignedLoop < iNumSpecialists; iAssignedLoop++)
 	{
@@ -3589,7 +3598,7 @@ void CvCityCitizens::DoRemoveAllSpecialistsFromBuilding(BuildingTypes eBuilding,
 		m_aiNumSpecialistsInBuilding[eBuilding]--;
 		GetCity()->processSpecialist(eSpecialist, -1);
 
-		GET_PLAYER(GetCity()->getOwner()).CalculateNetHappiness();
+		kOwner.CalculateNetHappiness();
 
 		// Do we kill this population or reassign him?
 		if(bEliminatePopulation)
@@ -3609,6 +3618,8 @@ void CvCityCitizens::DoRemoveAllSpecialistsFromBuilding(BuildingTypes eBuilding,
 		auto_ptr<ICvCity1> pCity = GC.WrapCityPointer(GetCity());
 		GC.GetEngineUserInterface()->SetSpecificCityInfoDirty(pCity.get(), CITY_UPDATE_TYPE_SPECIALISTS);
 	}
+
+	kOwner.EndHappinessUpdateBatch();
 }
 
 
@@ -895,9 +895,12 @@ void CvCityStrategyAI::ChooseProduction(BuildingTypes eIgnoreBldg /* = NO_BUILDI
 		}
 	}
 
-	// Loop through adding the available units
-	for(iUnitLoop = 0; iUnitLoop < GC.GetGameUnits()->GetNumUnits(); iUnitLoop++)
-	{	
+	// Loop through adding the available units (only those this civ can ever train)
+	const std::vector<UnitTypes>& vUnitCandidates = kPlayer.GetProductionUnitCandidates();
+	for(size_t iCandidate = 0; iCandidate < vUnitCandidates.size(); iCandidate++)
+	{
+		iUnitLoop = vUnitCandidates[iCandidate];
+
 		// Make sure this unit can be built now
 		if((UnitTypes)iUnitLoop != eIgnoreUnit && m_pCity->canTrain((UnitTypes)iUnitLoop))
 		{
@@ -925,15 +928,12 @@ void CvCityStrategyAI::ChooseProduction(BuildingTypes eIgnoreBldg /* = NO_BUILDI
 		}
 	}
 	
-	// Loop through adding the available buildings
-	for(iBldgLoop = 0; iBldgLoop < GC.GetGameBuildings()->GetNumBuildings(); iBldgLoop++)
+	// Loop through adding the available buildings (only those this civ can ever construct)
+	const std::vector<BuildingTypes>& vBuildingCandidates = kPlayer.GetProductionBuildingCandidates();
+	for(size_t iCandidate = 0; iCandidate < vBuildingCandidates.size(); iCandidate++)
 	{
-		const BuildingTypes eLoopBuilding = static_cast<BuildingTypes>(iBldgLoop);
-		CvBuildingEntry* pkBuildingInfo = GC.getBuildingInfo(eLoopBuilding);
-
-		//Skip if null
-		if(pkBuildingInfo == NULL)
-			continue;
+		const BuildingTypes eLoopBuilding = vBuildingCandidates[iCandidate];
+		iBldgLoop = eLoopBuilding;
 
 		// Make sure this building can be built now
 		if((BuildingTypes)iBldgLoop != eIgnoreBldg && m_pCity->canConstruct(eLoopBuilding,vTotalBuildingCount))
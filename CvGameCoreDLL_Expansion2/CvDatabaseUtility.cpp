@@ -149,6 +149,7 @@ bool CvDatabaseUtility::PopulateArrayByExistence(bool*& pArray, const char* szTy
 	std::string strKey = "_PABE_";
 	strKey.append(szTypeTableName);
 	strKey.append(szDataTableName);
+	strKey.append(szTypeColumn);
 	strKey.append(szFilterColumn);
 
 	Database::Results* pResults = GetResults(strKey);
@@ -186,6 +187,7 @@ bool CvDatabaseUtility::PopulateArrayByExistence(int*& pArray, const char* szTyp
 	std::string strKey = "_PABE_";
 	strKey.append(szTypeTableName);
 	strKey.append(szDataTableName);
+	strKey.append(szTypeColumn);
 	strKey.append(szFilterColumn);
 
 	Database::Results* pResults = GetResults(strKey);
@@ -223,6 +225,7 @@ bool CvDatabaseUtility::PopulateArrayByValue(int*& pArray, const char* szTypeTab
 	std::string strKey = "_PABV_";
 	strKey.append(szTypeTableName);
 	strKey.append(szDataTableName);
+	strKey.append(szTypeColumn);
 	strKey.append(szFilterColumn);
 	strKey.append(szValueColumn);
 
@@ -274,6 +277,12 @@ bool CvDatabaseUtility::SetYields(int*& pYieldsArray,
 //------------------------------------------------------------------------------
 int CvDatabaseUtility::MaxRows(const char* szTableName)
 {
+	//every info entry sizes its arrays by the same handful of tables, only ask the database once
+	const std::string strTableName(szTableName);
+	RowCountMap::const_iterator it = m_rowCounts.find(strTableName);
+	if(it != m_rowCounts.end())
+		return it->second;
+
 	char szSQL[256] = {0};
 	sprintf_s(szSQL, "SELECT max(rowid) from %s", szTableName);
 	Database::Results kResults;
@@ -287,6 +296,7 @@ int CvDatabaseUtility::MaxRows(const char* szTableName)
 		}
 	}
 
+	m_rowCounts[strTableName] = maxValue;
 	return maxValue;
 }
 //------------------------------------------------------------------------------
@@ -94,6 +94,7 @@ void InitializeArray(T*& pArray, const char* szTableName, T default = (T)0);
 	bool SetYields(int*& pYieldsArray, const char* szTableName, const char* szFilterColumn, const char* szFilterValue);
 
 	//! Retrieves the maximum number of a given column for a given table.
+	//! The result is remembered for the lifetime of this utility, the database is not expected to change while loading.
 	int MaxRows(const char* szTableName);
 
 	//! Returns the most recent database error message.
@@ -102,6 +103,9 @@ void InitializeArray(T*& pArray, const char* szTableName, T default = (T)0);
 private:
 	typedef stdext::hash_map<std::string, Database::Results*> ResultsMap;
 	ResultsMap m_storedResults;
+
+	typedef stdext::hash_map<std::string, int> RowCountMap;
+	RowCountMap m_rowCounts;
 };
 
 //------------------------------------------------------------------------------
@@ -7363,7 +7363,7 @@ bool CvDealAI::IsMakeOfferForStrategicResource(PlayerTypes eOtherPlayer, CvDeal*
 		if(GET_PLAYER(eOtherPlayer).getNumResourceAvailable(eResource, false) > 3 && GetPlayer()->getNumResourceAvailable(eResource, true) <= 0)
 		{
 			int iNum = GET_PLAYER(eOtherPlayer).getNumResourceAvailable(eResource, false);
-			iRand = GC.getGame().getSmallFakeRandNum(max(iNum, 10), eResource);
+			iRand = GC.getGame().getKeyedRandNum(max(iNum, 10), RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), eResource);
 			iRand /= 2;
 			if(iRand <= 0)
 			{
@@ -6633,7 +6633,7 @@ void CvDiplomacyAI::DoUpdateDemands()
 			{
 				iChanceOfDemand = 1;
 			}
-			if (iChanceOfDemand > GC.getGame().getSmallFakeRandNum(iChanceOfDemand, veDemandTargetPlayers.GetElement(0)))
+			if (iChanceOfDemand > GC.getGame().getKeyedRandNum(iChanceOfDemand, RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), veDemandTargetPlayers.GetElement(0)))
 			{
 				DoStartDemandProcess(veDemandTargetPlayers.GetElement(0));
 			}
@@ -6908,7 +6908,7 @@ bool CvDiplomacyAI::IsMakeRequest(PlayerTypes ePlayer, CvDeal* pDeal, bool& bRan
 		if(bWantsSomething)
 		{
 			// Random element
-			int iRand = GC.getGame().getSmallFakeRandNum(10, ePlayer);
+			int iRand = GC.getGame().getKeyedRandNum(10, RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), ePlayer);
 
 			iRand += iWeightBias;
 
@@ -16652,7 +16652,7 @@ void CvDiplomacyAI::DoSendStatementToPlayer(PlayerTypes ePlayer, DiploStatementT
 			if(GET_TEAM(GET_PLAYER(ePlayer).getTeam()).canDeclareWar(GetPlayer()->getTeam()))
 #endif
 			{
-				if (GC.getGame().getSmallFakeRandNum(10, ePlayer) < GetWarmongerHate())
+				if (GC.getGame().getKeyedRandNum(10, RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), ePlayer) < GetWarmongerHate())
 				{
 					bValid = true;
 				}
@@ -18542,7 +18542,7 @@ void CvDiplomacyAI::DoContactMinorCivs()
 		else
 		{
 			int iThreshold = iExpansionFlavor; //antonjs: todo: xml
-			int iRandRoll = GC.getGame().getSmallFakeRandNum(10, iExpansionFlavor);
+			int iRandRoll = GC.getGame().getKeyedRandNum(10, RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), iExpansionFlavor);
 
 			if(iRandRoll < iThreshold)
 				bWantsToBuyout = true;
@@ -18583,7 +18583,7 @@ void CvDiplomacyAI::DoContactMinorCivs()
 	else
 	{
 		int iThreshold = iDiplomacyFlavor;
-		int iRandRoll = GC.getGame().getSmallFakeRandNum(10, iDiplomacyFlavor);
+		int iRandRoll = GC.getGame().getKeyedRandNum(10, RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), iDiplomacyFlavor);
 
 		// Threshold will be 15 for a player (3 flavor * 5)
 		// Threshold will be 5 for non-diplomatic player (2 flavor * 5)
@@ -18622,7 +18622,7 @@ void CvDiplomacyAI::DoContactMinorCivs()
 					{
 						iThreshold = 10;
 					}
-					int iRandRoll = GC.getGame().getSmallFakeRandNum(10, iScienceFlavor);
+					int iRandRoll = GC.getGame().getKeyedRandNum(10, RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), iScienceFlavor);
 
 					if(iRandRoll < iThreshold)
 						bWantsToBullyUnit = true;
@@ -18636,7 +18636,7 @@ void CvDiplomacyAI::DoContactMinorCivs()
 					{
 						iThreshold = 10;
 					}
-					int iRandRoll = GC.getGame().getSmallFakeRandNum(10, iProductionFlavor);
+					int iRandRoll = GC.getGame().getKeyedRandNum(10, RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), iProductionFlavor);
 
 					if(iRandRoll < iThreshold)
 						bWantsToBullyUnit = true;
@@ -18650,7 +18650,7 @@ void CvDiplomacyAI::DoContactMinorCivs()
 					{
 						iThreshold = 10;
 					}
-					int iRandRoll = GC.getGame().getSmallFakeRandNum(10, iCultureFlavor);
+					int iRandRoll = GC.getGame().getKeyedRandNum(10, RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), iCultureFlavor);
 
 					if(iRandRoll < iThreshold)
 						bWantsToBullyUnit = true;
@@ -18664,7 +18664,7 @@ void CvDiplomacyAI::DoContactMinorCivs()
 					{
 						iThreshold = 10;
 					}
-					int iRandRoll = GC.getGame().getSmallFakeRandNum(10, iFaithFlavor);
+					int iRandRoll = GC.getGame().getKeyedRandNum(10, RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), iFaithFlavor);
 
 					if(iRandRoll < iThreshold)
 						bWantsToBullyUnit = true;
@@ -18678,7 +18678,7 @@ void CvDiplomacyAI::DoContactMinorCivs()
 					{
 						iThreshold = 10;
 					}
-					int iRandRoll = GC.getGame().getSmallFakeRandNum(10, iGrowthFlavor);
+					int iRandRoll = GC.getGame().getKeyedRandNum(10, RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), iGrowthFlavor);
 
 					if(iRandRoll < iThreshold)
 						bWantsToBullyUnit = true;
@@ -18695,7 +18695,7 @@ void CvDiplomacyAI::DoContactMinorCivs()
 					else
 					{
 						int iThreshold = iTileImprovementFlavor; //antonjs: todo: XML
-						int iRandRoll = GC.getGame().getSmallFakeRandNum(10, iTileImprovementFlavor);
+						int iRandRoll = GC.getGame().getKeyedRandNum(10, RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), iTileImprovementFlavor);
 
 						if(iRandRoll < iThreshold)
 							bWantsToBullyUnit = true;
@@ -18716,7 +18716,7 @@ void CvDiplomacyAI::DoContactMinorCivs()
 	else
 	{
 		int iThreshold = iTileImprovementFlavor; //antonjs: todo: XML
-		int iRandRoll = GC.getGame().getSmallFakeRandNum(10, iTileImprovementFlavor);
+		int iRandRoll = GC.getGame().getKeyedRandNum(10, RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), iTileImprovementFlavor);
 
 		if(iRandRoll < iThreshold)
 			bWantsToBullyUnit = true;
@@ -18745,7 +18745,7 @@ void CvDiplomacyAI::DoContactMinorCivs()
 	else
 	{
 		int iThreshold = iGoldFlavor; //antonjs: todo: XML
-		int iRandRoll = GC.getGame().getSmallFakeRandNum(10, iGoldFlavor);
+		int iRandRoll = GC.getGame().getKeyedRandNum(10, RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), iGoldFlavor);
 
 		if(iRandRoll < iThreshold)
 			bWantsToBullyGold = true;
@@ -19239,7 +19239,7 @@ void CvDiplomacyAI::DoContactMinorCivs()
 							{
 								iValue += (GET_PLAYER(eMinor).GetMinorCivAI()->GetYieldTheftAmount(GetPlayer()->GetID(), YIELD_FOOD) * iGrowthFlavor);
 							}
-							iValue += GC.getGame().getSmallFakeRandNum(GetBoldness(), eID);
+							iValue += GC.getGame().getKeyedRandNum(GetBoldness(), RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), eID);
 						}
 						else
 						{
@@ -20673,7 +20673,7 @@ void CvDiplomacyAI::DoEmbassyExchange(PlayerTypes ePlayer, DiploStatementTypes&
 						bSendStatement = true;
 
 					// 1 in 2 chance we don't actually send the message (don't want full predictability)
-					if (5 < GC.getGame().getSmallFakeRandNum(10, ePlayer))
+					if (5 < GC.getGame().getKeyedRandNum(10, RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), ePlayer))
 						bSendStatement = false;
 
 					if(bSendStatement)
@@ -21650,7 +21650,7 @@ void CvDiplomacyAI::DoWarmongerStatement(PlayerTypes ePlayer, DiploStatementType
 				bSendStatement = false;
 
 			// 2 in 3 chance we don't actually send the message (don't want to bombard the player from all sides)
-			if (4 < GC.getGame().getSmallFakeRandNum(10, ePlayer))
+			if (4 < GC.getGame().getKeyedRandNum(10, RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), ePlayer))
 				bSendStatement = false;
 
 			DiploStatementTypes eTempStatement = DIPLO_STATEMENT_WARMONGER;
@@ -21762,7 +21762,7 @@ void CvDiplomacyAI::DoAngryBefriendedEnemy(PlayerTypes ePlayer, DiploStatementTy
 
 				// Found a match!
 				int iWeight = GetMeanness();		// Usually ranges from 3 to 7
-				iWeight += GC.getGame().getSmallFakeRandNum(10, iWeight);
+				iWeight += GC.getGame().getKeyedRandNum(10, RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), iWeight);
 
 				// We're mean enough to say something
 				if(iWeight >= 10)
@@ -21830,7 +21830,7 @@ void CvDiplomacyAI::DoAngryDenouncedFriend(PlayerTypes ePlayer, DiploStatementTy
 				// Found a match!
 
 				int iWeight = GetMeanness();		// Usually ranges from 3 to 7
-				iWeight += GC.getGame().getSmallFakeRandNum(10, iWeight);
+				iWeight += GC.getGame().getKeyedRandNum(10, RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), iWeight);
 
 				// We're mean enough to say something
 				if(iWeight >= 10)
@@ -21898,7 +21898,7 @@ void CvDiplomacyAI::DoHappyDenouncedEnemy(PlayerTypes ePlayer, DiploStatementTyp
 				// Found a match!
 
 				int iWeight = GetChattiness();		// Usually ranges from 3 to 7
-				iWeight += GC.getGame().getSmallFakeRandNum(10, iWeight);
+				iWeight += GC.getGame().getKeyedRandNum(10, RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), iWeight);
 
 				// We're chatty enough to say something
 				if(iWeight >= 10)
@@ -21966,7 +21966,7 @@ void CvDiplomacyAI::DoHappyBefriendedFriend(PlayerTypes ePlayer, DiploStatementT
 				// Found a match!
 
 				int iWeight = GetChattiness();		// Usually ranges from 3 to 7
-				iWeight += GC.getGame().getSmallFakeRandNum(10, iWeight);
+				iWeight += GC.getGame().getKeyedRandNum(10, RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), iWeight);
 
 				// We're chatty enough to say something
 				if(iWeight >= 10)
@@ -22089,7 +22089,7 @@ void CvDiplomacyAI::DoFYIBefriendedHumanEnemy(PlayerTypes ePlayer, DiploStatemen
 					iWeight += 10;
 
 				iWeight += GetMeanness();		// Usually ranges from 3 to 7
-				iWeight += GC.getGame().getSmallFakeRandNum(10, iWeight);
+				iWeight += GC.getGame().getKeyedRandNum(10, RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), iWeight);
 
 				// We're mean enough to say something
 				if(iWeight >= 10)
@@ -22174,7 +22174,7 @@ void CvDiplomacyAI::DoFYIDenouncedHumanFriend(PlayerTypes ePlayer, DiploStatemen
 					iWeight += 10;
 
 				iWeight += GetMeanness();		// Usually ranges from 3 to 7
-				iWeight += GC.getGame().getSmallFakeRandNum(10, iWeight);
+				iWeight += GC.getGame().getKeyedRandNum(10, RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), iWeight);
 
 				// We're mean enough to say something
 				if(iWeight >= 10)
@@ -22266,7 +22266,7 @@ void CvDiplomacyAI::DoFYIDenouncedHumanEnemy(PlayerTypes ePlayer, DiploStatement
 					iWeight += 3;
 
 				iWeight += GetChattiness();		// Usually ranges from 3 to 7
-				iWeight += GC.getGame().getSmallFakeRandNum(10, iWeight);
+				iWeight += GC.getGame().getKeyedRandNum(10, RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), iWeight);
 
 				// We're mean enough to say something
 				if(iWeight >= 10)
@@ -22375,7 +22375,7 @@ void CvDiplomacyAI::DoFYIBefriendedHumanFriend(PlayerTypes ePlayer, DiploStateme
 					iWeight += 2;
 
 				iWeight += GetChattiness();		// Usually ranges from 3 to 7
-				iWeight += GC.getGame().getSmallFakeRandNum(10, iWeight);
+				iWeight += GC.getGame().getKeyedRandNum(10, RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), iWeight);
 
 				// We're mean enough to say something
 				if(iWeight >= 10)
@@ -22421,7 +22421,7 @@ void CvDiplomacyAI::DoHappySamePolicyTree(PlayerTypes ePlayer, DiploStatementTyp
 				bSkip = true;
 
 			// Check chattiness to see if we send the message this turn
-			if (!bSkip && GetChattiness() > GC.getGame().getSmallFakeRandNum(10, ePlayer))
+			if (!bSkip && GetChattiness() > GC.getGame().getKeyedRandNum(10, RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), ePlayer))
 			{
 				DiploStatementTypes eOtherStatementToCheck = NO_DIPLO_STATEMENT_TYPE;
 
@@ -22817,7 +22817,7 @@ void CvDiplomacyAI::DoWeLikedTheirProposal(PlayerTypes ePlayer, DiploStatementTy
 				bSkip = true;
 			if(eApproach == MAJOR_CIV_APPROACH_WAR || eApproach == MAJOR_CIV_APPROACH_HOSTILE)
 				bSkip = true;
-			if (!bSkip && GetChattiness() > GC.getGame().getSmallFakeRandNum(10, ePlayer))
+			if (!bSkip && GetChattiness() > GC.getGame().getKeyedRandNum(10, RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), ePlayer))
 			{
 				eTempStatement = DIPLO_STATEMENT_WE_LIKED_THEIR_PROPOSAL;
 				int iTurnsBetweenStatements = GC.getOPINION_WEIGHT_WE_LIKED_THEIR_PROPOSAL_NUM_TURNS();
@@ -22866,7 +22866,7 @@ void CvDiplomacyAI::DoWeDislikedTheirProposal(PlayerTypes ePlayer, DiploStatemen
 				bSkip = true;
 			if(eApproach == MAJOR_CIV_APPROACH_FRIENDLY)
 				bSkip = true;
-			if (!bSkip && GetChattiness() > GC.getGame().getSmallFakeRandNum(10, ePlayer))
+			if (!bSkip && GetChattiness() > GC.getGame().getKeyedRandNum(10, RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), ePlayer))
 			{
 				eTempStatement = DIPLO_STATEMENT_WE_DISLIKED_THEIR_PROPOSAL;
 				int iTurnsBetweenStatements = GC.getOPINION_WEIGHT_WE_DISLIKED_THEIR_PROPOSAL_NUM_TURNS();
@@ -25087,7 +25087,7 @@ void CvDiplomacyAI::DoFromUIDiploEvent(PlayerTypes eFromPlayer, FromUIDiploEvent
 		bool bDeclareWar = false;
 
 #if defined(MOD_BALANCE_CORE_DIPLOMACY)
-		if (GC.getGame().getSmallFakeRandNum(10, eFromPlayer) < ((GetMeanness() + GetBoldness()) / 2))
+		if (GC.getGame().getKeyedRandNum(10, RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), eFromPlayer) < ((GetMeanness() + GetBoldness()) / 2))
 #else
 		if(GC.getGame().getJonRandNum(100, "Human demand refusal war rand.") < 50)
 #endif
@@ -25639,7 +25639,7 @@ void CvDiplomacyAI::DoFromUIDiploEvent(PlayerTypes eFromPlayer, FromUIDiploEvent
 					{
 						iChance = 40;
 					}
-					if (GC.getGame().getSmallFakeRandNum(10, eFromPlayer) > (iChance - GetMeanness() - GetBoldness()))
+					if (GC.getGame().getKeyedRandNum(10, RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), eFromPlayer) > (iChance - GetMeanness() - GetBoldness()))
 					{
 						bDeclareWar = true;
 					}
@@ -28354,7 +28354,7 @@ void CvDiplomacyAI::DoDemandMade(PlayerTypes ePlayer)
 	// See how long it'll be before we might agree to another demand
 
 	int iNumTurns = /*20*/ GC.getDEMAND_TURN_LIMIT_MIN();
-	int iRand = GC.getGame().getSmallFakeRandNum(GC.getDEMAND_TURN_LIMIT_RAND(), ePlayer);
+	int iRand = GC.getGame().getKeyedRandNum(GC.getDEMAND_TURN_LIMIT_RAND(), RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), ePlayer);
 	iNumTurns += iRand;
 
 	m_paiDemandTooSoonNumTurns[ePlayer] = iNumTurns;
@@ -28925,7 +28925,7 @@ bool CvDiplomacyAI::IsDoFAcceptable(PlayerTypes ePlayer)
 		iWeight += -1;
 #endif
 	// Rand
-	iWeight += GC.getGame().getSmallFakeRandNum(5, ePlayer);
+	iWeight += GC.getGame().getKeyedRandNum(5, RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), ePlayer);
 
 	if(iWeight >= /*12*/ GC.getDOF_THRESHOLD())
 		return true;
@@ -29408,7 +29408,7 @@ bool CvDiplomacyAI::IsDenounceFriendAcceptable(PlayerTypes ePlayer)
 		iChance -= 5;
 	}
 #endif
-	int iRand = GC.getGame().getSmallFakeRandNum(10, ePlayer);
+	int iRand = GC.getGame().getKeyedRandNum(10, RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), ePlayer);
 	if(iRand < iChance)
 		return true;
 
@@ -29840,7 +29840,7 @@ int CvDiplomacyAI::GetDenounceWeight(PlayerTypes ePlayer, bool bBias)
 	}
 
 	// Rand: 0-5
-	iWeight += GC.getGame().getSmallFakeRandNum(5, ePlayer);
+	iWeight += GC.getGame().getKeyedRandNum(5, RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), ePlayer);
 
 	// Used when friends are asking us to denounce someone
 	if(bBias)
@@ -39936,7 +39936,7 @@ bool CvDiplomacyAI::IsEndVassalageRequestAcceptable(PlayerTypes ePlayer)
 		iChanceToGiveIn = 3;
 	}
 
-	int iRand = GC.getGame().getSmallFakeRandNum(10, ePlayer);
+	int iRand = GC.getGame().getKeyedRandNum(10, RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), ePlayer);
 
 	if(iRand < iChanceToGiveIn)
 		return true;
@@ -40239,7 +40239,7 @@ bool CvDiplomacyAI::IsMakeGenerousOffer(PlayerTypes ePlayer, CvDeal* pDeal, bool
 		if(bWantsToOfferSomething)
 		{
 			// Random element
-			int iRand = GC.getGame().getSmallFakeRandNum(10, ePlayer);
+			int iRand = GC.getGame().getKeyedRandNum(10, RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), ePlayer);
 
 			// modifier based on AI loyalty
 			int iModifier = (GetLoyalty() - 5);	// +20 for 7 Loyalty, +0 for 5 Loyalty, -30 for 2 Loyalty, +50 for 10 Loyalty
@@ -40542,7 +40542,7 @@ bool CvDiplomacyAI::IsShareOpinionAcceptable(PlayerTypes ePlayer)
 		iThreshold = 3;
 	}
 
-	int iRand = GC.getGame().getSmallFakeRandNum(10, ePlayer);
+	int iRand = GC.getGame().getKeyedRandNum(10, RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), ePlayer);
 
 	if(iRand < iThreshold)
 		return true;
@@ -40651,7 +40651,7 @@ void CvDiplomacyAI::DoHelpRequestMade(PlayerTypes ePlayer)
 	// See how long it'll be before we might agree to another help request
 
 	int iNumTurns = /*20*/ GC.getHELP_REQUEST_TURN_LIMIT_MIN();
-	int iRand = GC.getGame().getSmallFakeRandNum(/*10*/ GC.getHELP_REQUEST_TURN_LIMIT_RAND(),  ePlayer);
+	int iRand = GC.getGame().getKeyedRandNum(/*10*/ GC.getHELP_REQUEST_TURN_LIMIT_RAND(), RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), ePlayer);
 	iNumTurns += iRand;
 
 	m_paiHelpRequestTooSoonNumTurns[ePlayer] = iNumTurns;
@@ -42075,7 +42075,7 @@ void CvDiplomacyAI::DoDetermineTaxRateForVassalOnePlayer(PlayerTypes ePlayer)
 						if(iVassalCurrentGPT * 150 < iMyCurrentGPT * 100)
 							iThreshold = 7;
 
-						int iRand = GC.getGame().getSmallFakeRandNum(10, ePlayer);
+						int iRand = GC.getGame().getKeyedRandNum(10, RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), ePlayer);
 						if(iRand < iThreshold)
 						{
 							iScoreForLower *= 150;
@@ -42471,7 +42471,7 @@ int CvDiplomacyAI::IsMoveTroopsRequestAcceptable(PlayerTypes ePlayer, bool bJust
 
 	for(int i=0; i < NUM_MOVE_TROOPS_RESPONSE_TYPES; i++)
 	{
-		iRand = GC.getGame().getSmallFakeRandNum(5, ePlayer);
+		iRand = GC.getGame().getKeyedRandNum(5, RAND_STREAM_DIPLOMACY_AI, m_pPlayer->GetID(), ePlayer);
 		viMoveTroopsWeights[i] += iRand;
 	}
 
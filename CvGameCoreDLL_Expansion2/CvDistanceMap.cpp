@@ -110,8 +110,14 @@ void CvDistanceMapPlots::Update()
 	m_vClosestFeature = std::vector<int>(nPlots, 0);
 	m_bArrayAllocated = true;
 
-	// since we know there are very few cities compared to the number of plots,
-	// we don't need to do the full distance transform
+	// multi-source breadth-first search from all cities at once, so every plot is visited once instead of once per city.
+	// sources are numbered in iteration order; on equal distance the earlier founded city wins, then the earlier source,
+	// which is the same tie break as comparing each city against each plot
+	std::vector<int> vSourceFounded;
+	std::vector<int> vSourceFeature;
+	std::vector<int> vClosestSource(nPlots, -1);
+	std::vector<int> vQueue;
+	vQueue.reserve(nPlots);
 
 	for (int i = 0; i < MAX_PLAYERS; i++)
 	{
@@ -123,31 +129,45 @@ void CvDistanceMapPlots::Update()
 		int iCityIndex = 0;
 		for (CvCity* pLoopCity = thisPlayer.firstCity(&iCityIndex); pLoopCity != NULL; pLoopCity = thisPlayer.nextCity(&iCityIndex))
 		{
-			CvPlot* pCityPlot = pLoopCity->plot();
+			int iPlotIndex = pLoopCity->plot()->GetPlotIndex();
+			if (vClosestSource[iPlotIndex] != -1)
+				continue;
 
-			for (int iPlotIndex = 0; iPlotIndex<nPlots; iPlotIndex++)
+			vClosestSource[iPlotIndex] = (int)vSourceFounded.size();
+			vSourceFounded.push_back(pLoopCity->getGameTurnFounded());
+			vSourceFeature.push_back(PACK(pLoopCity->getOwner(), pLoopCity->GetID()));
+
+			m_vDistance[iPlotIndex] = 0;
+			vQueue.push_back(iPlotIndex);
+		}
+	}
+
+	// the queue holds plots in order of distance, so all of a plot's candidates are known before it is expanded
+	for (size_t iHead = 0; iHead < vQueue.size(); iHead++)
+	{
+		int iPlotIndex = vQueue[iHead];
+		int iSource = vClosestSource[iPlotIndex];
+		int iNextDistance = m_vDistance[iPlotIndex] + 1;
+		m_vClosestFeature[iPlotIndex] = vSourceFeature[iSource];
+
+		CvPlot** aNeighbors = map.getNeighborsUnchecked(map.plotByIndexUnchecked(iPlotIndex));
+		for (int iDir = 0; iDir < NUM_DIRECTION_TYPES; iDir++)
+		{
+			if (aNeighbors[iDir] == NULL)
+				continue;
+
+			int iNeighbor = aNeighbors[iDir]->GetPlotIndex();
+			if (m_vDistance[iNeighbor] == INT_MAX)
 			{
-				CvPlot* pPlot = map.plotByIndexUnchecked(iPlotIndex);
-				if (pPlot)
-				{
-					int iDistance = plotDistance(pCityPlot->getX(), pCityPlot->getY(), pPlot->getX(), pPlot->getY());
-
-					bool bUpdate = (iDistance < m_vDistance[iPlotIndex]);
-
-					//in case of equal distance, take care not to prefer the player with the lower ID
-					if (iDistance == m_vDistance[iPlotIndex])
-					{
-						PlayerTypes currentOwner = (PlayerTypes)UNPACK_OWNER(m_vClosestFeature[iPlotIndex]);
-						CvCity* pCurrentCity = GET_PLAYER(currentOwner).getCity(UNPACK_ID(m_vClosestFeature[iPlotIndex]));
-						bUpdate = (pCurrentCity->getGameTurnFounded() > pLoopCity->getGameTurnFounded());
-					}
-
-					if (bUpdate)
-					{
-						m_vDistance[iPlotIndex] = iDistance;
-						m_vClosestFeature[iPlotIndex] = PACK(pLoopCity->getOwner(), pLoopCity->GetID());
-					}
-				}
+				m_vDistance[iNeighbor] = iNextDistance;
+				vClosestSource[iNeighbor] = iSource;
+				vQueue.push_back(iNeighbor);
+			}
+			else if (m_vDistance[iNeighbor] == iNextDistance)
+			{
+				int iCurrent = vClosestSource[iNeighbor];
+				if (vSourceFounded[iSource] < vSourceFounded[iCurrent] || (vSourceFounded[iSource] == vSourceFounded[iCurrent] && iSource < iCurrent))
+					vClosestSource[iNeighbor] = iSource;
 			}
 		}
 	}
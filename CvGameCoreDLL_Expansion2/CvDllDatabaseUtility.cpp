@@ -282,132 +282,135 @@ bool CvDllDatabaseUtility::PrefetchGameData()
 {
 	cvStopWatch kTest("PrefetchGameData", "xml-perf.log");
 
+	//One utility for all collections so prepared statements and table sizes are shared between them.
+	CvDatabaseUtility kUtility;
+
 	//Because Colors and PlayerColors are used everywhere during load
 	//(by the translator) we load interface infos first.
 	//Interface
-	PrefetchCollection(GC.GetColorInfo(), "Colors");
-	PrefetchCollection(GC.GetPlayerColorInfo(), "PlayerColors");
-	PrefetchCollection(GC.getInterfaceModeInfo(), "InterfaceModes");
+	PrefetchCollection(GC.GetColorInfo(), "Colors", kUtility);
+	PrefetchCollection(GC.GetPlayerColorInfo(), "PlayerColors", kUtility);
+	PrefetchCollection(GC.getInterfaceModeInfo(), "InterfaceModes", kUtility);
 
 	//AI
-	PrefetchCollection(GC.getAICityStrategyInfo(), "AICityStrategies");
-	PrefetchCollection(GC.getEconomicAIStrategyInfo(), "AIEconomicStrategies");
-	PrefetchCollection(GC.getAIGrandStrategyInfo(), "AIGrandStrategies");
-	PrefetchCollection(GC.getMilitaryAIStrategyInfo(), "AIMilitaryStrategies");
-	PrefetchCollection(GC.getCitySpecializationInfo(), "CitySpecializations");
-	PrefetchCollection(GC.getTacticalMoveInfo(), "TacticalMoves");
+	PrefetchCollection(GC.getAICityStrategyInfo(), "AICityStrategies", kUtility);
+	PrefetchCollection(GC.getEconomicAIStrategyInfo(), "AIEconomicStrategies", kUtility);
+	PrefetchCollection(GC.getAIGrandStrategyInfo(), "AIGrandStrategies", kUtility);
+	PrefetchCollection(GC.getMilitaryAIStrategyInfo(), "AIMilitaryStrategies", kUtility);
+	PrefetchCollection(GC.getCitySpecializationInfo(), "CitySpecializations", kUtility);
+	PrefetchCollection(GC.getTacticalMoveInfo(), "TacticalMoves", kUtility);
 
 	//BasicInfos
 	//AnimationOperators?
 	//Attitudes?
-	PrefetchCollection(GC.getUnitAIInfo(), "UnitAIInfos");
-	PrefetchCollection(GC.getUnitCombatClassInfo(), "UnitCombatInfos");
+	PrefetchCollection(GC.getUnitAIInfo(), "UnitAIInfos", kUtility);
+	PrefetchCollection(GC.getUnitCombatClassInfo(), "UnitCombatInfos", kUtility);
 
 	//Buildings
-	PrefetchCollection(GC.getBuildingClassInfo(), "BuildingClasses");
-	PrefetchCollection(GC.getBuildingInfo(), "Buildings");
+	PrefetchCollection(GC.getBuildingClassInfo(), "BuildingClasses", kUtility);
+	PrefetchCollection(GC.getBuildingInfo(), "Buildings", kUtility);
 
 	//GameInfo
-	PrefetchCollection(GC.getEmphasisInfo(), "EmphasizeInfos");
-	PrefetchCollection(GC.getEraInfo(), "Eras");
-	PrefetchCollection(GC.getGameOptionInfo(), "GameOptions");
-	PrefetchCollection(GC.getGameSpeedInfo(), "GameSpeeds");
-	PrefetchCollection(GC.getHandicapInfo(), "HandicapInfos");
-	PrefetchCollection(GC.getHurryInfo(), "HurryInfos");
-	PrefetchCollection(GC.getMPOptionInfo(), "MultiplayerOptions");
-	PrefetchCollection(GC.getPlayerOptionInfo(), "PlayerOptions");
-	PrefetchCollection(GC.getPolicyInfo(), "Policies");
-	PrefetchCollection(GC.getPolicyBranchInfo(), "PolicyBranchTypes");
-	PrefetchCollection(GC.getProcessInfo(), "Processes");
-	PrefetchCollection(GC.getProjectInfo(), "Projects");
-	PrefetchCollection(GC.getSmallAwardInfo(), "SmallAwards");
-	PrefetchCollection(GC.getSpecialistInfo(), "Specialists");
-	PrefetchCollection(GC.getVictoryInfo(), "Victories");
-	PrefetchCollection(GC.getVoteInfo(), "Votes");
-	PrefetchCollection(GC.getVoteSourceInfo(), "VoteSources");
+	PrefetchCollection(GC.getEmphasisInfo(), "EmphasizeInfos", kUtility);
+	PrefetchCollection(GC.getEraInfo(), "Eras", kUtility);
+	PrefetchCollection(GC.getGameOptionInfo(), "GameOptions", kUtility);
+	PrefetchCollection(GC.getGameSpeedInfo(), "GameSpeeds", kUtility);
+	PrefetchCollection(GC.getHandicapInfo(), "HandicapInfos", kUtility);
+	PrefetchCollection(GC.getHurryInfo(), "HurryInfos", kUtility);
+	PrefetchCollection(GC.getMPOptionInfo(), "MultiplayerOptions", kUtility);
+	PrefetchCollection(GC.getPlayerOptionInfo(), "PlayerOptions", kUtility);
+	PrefetchCollection(GC.getPolicyInfo(), "Policies", kUtility);
+	PrefetchCollection(GC.getPolicyBranchInfo(), "PolicyBranchTypes", kUtility);
+	PrefetchCollection(GC.getProcessInfo(), "Processes", kUtility);
+	PrefetchCollection(GC.getProjectInfo(), "Projects", kUtility);
+	PrefetchCollection(GC.getSmallAwardInfo(), "SmallAwards", kUtility);
+	PrefetchCollection(GC.getSpecialistInfo(), "Specialists", kUtility);
+	PrefetchCollection(GC.getVictoryInfo(), "Victories", kUtility);
+	PrefetchCollection(GC.getVoteInfo(), "Votes", kUtility);
+	PrefetchCollection(GC.getVoteSourceInfo(), "VoteSources", kUtility);
 #if defined(MOD_BALANCE_CORE)
-	PrefetchCollection(GC.getEventInfo(), "Events");
-	PrefetchCollection(GC.getEventChoiceInfo(), "EventChoices");
-	PrefetchCollection(GC.getCityEventInfo(), "CityEvents");
-	PrefetchCollection(GC.getCityEventChoiceInfo(), "CityEventChoices");
+	PrefetchCollection(GC.getEventInfo(), "Events", kUtility);
+	PrefetchCollection(GC.getEventChoiceInfo(), "EventChoices", kUtility);
+	PrefetchCollection(GC.getCityEventInfo(), "CityEvents", kUtility);
+	PrefetchCollection(GC.getCityEventChoiceInfo(), "CityEventChoices", kUtility);
 #endif
-	PrefetchCollection(GC.getUnitDomainInfo(), "Domains");
+	PrefetchCollection(GC.getUnitDomainInfo(), "Domains", kUtility);
 
 #if defined(MOD_EVENTS_DIPLO_MODIFIERS)
-	PrefetchCollection(GC.getDiploModifierInfo(), "DiploModifiers");
+	PrefetchCollection(GC.getDiploModifierInfo(), "DiploModifiers", kUtility);
 #endif
 
 	//Leaders
-	PrefetchCollection(GC.getLeaderHeadInfo(), "Leaders");
+	PrefetchCollection(GC.getLeaderHeadInfo(), "Leaders", kUtility);
 
 	//Misc
-	PrefetchCollection(GC.getRouteInfo(), "Routes");
+	PrefetchCollection(GC.getRouteInfo(), "Routes", kUtility);
 
 	CvNotificationXMLEntries* pkNotificationEntries =  GC.GetNotificationEntries();
 	if(pkNotificationEntries != NULL)
 	{
-		PrefetchCollection(pkNotificationEntries->GetNotificationEntries(), "Notifications");
+		PrefetchCollection(pkNotificationEntries->GetNotificationEntries(), "Notifications", kUtility);
 	}
 
 	//Technologies
-	PrefetchCollection(GC.getTechInfo(), "Technologies");
+	PrefetchCollection(GC.getTechInfo(), "Technologies", kUtility);
 
 	//Terrain
-	PrefetchCollection(GC.getFeatureInfo(), "Features");
-	PrefetchCollection(GC.getImprovementInfo(), "Improvements");
-	PrefetchCollection(GC.getResourceClassInfo(), "ResourceClasses");
-	PrefetchCollection(GC.getResourceInfo(), "Resources");
+	PrefetchCollection(GC.getFeatureInfo(), "Features", kUtility);
+	PrefetchCollection(GC.getImprovementInfo(), "Improvements", kUtility);
+	PrefetchCollection(GC.getResourceClassInfo(), "ResourceClasses", kUtility);
+	PrefetchCollection(GC.getResourceInfo(), "Resources", kUtility);
 #if defined(MOD_API_PLOT_YIELDS)
 	if (MOD_API_PLOT_YIELDS) {
-		PrefetchCollection(GC.getPlotInfo(), "Plots");
+		PrefetchCollection(GC.getPlotInfo(), "Plots", kUtility);
 	}
 #endif
 #if defined(MOD_API_UNIFIED_YIELDS)
 	if (MOD_API_UNIFIED_YIELDS) {
-		PrefetchCollection(GC.getGreatPersonInfo(), "GreatPersons");
+		PrefetchCollection(GC.getGreatPersonInfo(), "GreatPersons", kUtility);
 	}
 #endif
-	PrefetchCollection(GC.getTerrainInfo(), "Terrains");
-	PrefetchCollection(GC.getYieldInfo(), "Yields");
+	PrefetchCollection(GC.getTerrainInfo(), "Terrains", kUtility);
+	PrefetchCollection(GC.getYieldInfo(), "Yields", kUtility);
 
 	//Units
-	PrefetchCollection(GC.getAutomateInfo(), "Automates");
-	PrefetchCollection(GC.getBuildInfo(), "Builds");
-	PrefetchCollection(GC.getCommandInfo(), "Commands");
-	PrefetchCollection(GC.getControlInfo(), "Controls");
-	PrefetchCollection(GC.getEntityEventInfo(), "EntityEvents");
-	PrefetchCollection(GC.getMissionInfo(), "Missions");
-	PrefetchCollection(GC.getMultiUnitFormationInfo(), "MultiUnitFormations");
-	PrefetchCollection(GC.getSpecialUnitInfo(), "SpecialUnits");
-	PrefetchCollection(GC.getUnitClassInfo(), "UnitClasses");
-	PrefetchCollection(GC.getPromotionInfo(), "UnitPromotions");
-	PrefetchCollection(GC.getUnitInfo(), "Units");
+	PrefetchCollection(GC.getAutomateInfo(), "Automates", kUtility);
+	PrefetchCollection(GC.getBuildInfo(), "Builds", kUtility);
+	PrefetchCollection(GC.getCommandInfo(), "Commands", kUtility);
+	PrefetchCollection(GC.getControlInfo(), "Controls", kUtility);
+	PrefetchCollection(GC.getEntityEventInfo(), "EntityEvents", kUtility);
+	PrefetchCollection(GC.getMissionInfo(), "Missions", kUtility);
+	PrefetchCollection(GC.getMultiUnitFormationInfo(), "MultiUnitFormations", kUtility);
+	PrefetchCollection(GC.getSpecialUnitInfo(), "SpecialUnits", kUtility);
+	PrefetchCollection(GC.getUnitClassInfo(), "UnitClasses", kUtility);
+	PrefetchCollection(GC.getPromotionInfo(), "UnitPromotions", kUtility);
+	GC.GetGamePromotions()->UpdateDerivedData();
+	PrefetchCollection(GC.getUnitInfo(), "Units", kUtility);
 
 	//Civilizations - must be after buildings and units
-	PrefetchCollection(GC.getCivilizationInfo(), "Civilizations");
-	PrefetchCollection(GC.getMinorCivInfo(), "MinorCivilizations");
-	PrefetchCollection(GC.getTraitInfo(), "Traits");
-	PrefetchCollection(GC.getReligionInfo(), "Religions");
-	PrefetchCollection(GC.getBeliefInfo(), "Beliefs");
-	PrefetchCollection(GC.getLeagueSpecialSessionInfo(), "LeagueSpecialSessions");
-	PrefetchCollection(GC.getLeagueNameInfo(), "LeagueNames");
-	PrefetchCollection(GC.getLeagueProjectInfo(), "LeagueProjects");
-	PrefetchCollection(GC.getLeagueProjectRewardInfo(), "LeagueProjectRewards");
-	PrefetchCollection(GC.getResolutionInfo(), "Resolutions");
+	PrefetchCollection(GC.getCivilizationInfo(), "Civilizations", kUtility);
+	PrefetchCollection(GC.getMinorCivInfo(), "MinorCivilizations", kUtility);
+	PrefetchCollection(GC.getTraitInfo(), "Traits", kUtility);
+	PrefetchCollection(GC.getReligionInfo(), "Religions", kUtility);
+	PrefetchCollection(GC.getBeliefInfo(), "Beliefs", kUtility);
+	PrefetchCollection(GC.getLeagueSpecialSessionInfo(), "LeagueSpecialSessions", kUtility);
+	PrefetchCollection(GC.getLeagueNameInfo(), "LeagueNames", kUtility);
+	PrefetchCollection(GC.getLeagueProjectInfo(), "LeagueProjects", kUtility);
+	PrefetchCollection(GC.getLeagueProjectRewardInfo(), "LeagueProjectRewards", kUtility);
+	PrefetchCollection(GC.getResolutionInfo(), "Resolutions", kUtility);
 
 #if defined(MOD_API_ACHIEVEMENTS) || defined(ACHIEVEMENT_HACKS)
-	PrefetchCollection(GC.getAchievementInfo(), "Achievements");
+	PrefetchCollection(GC.getAchievementInfo(), "Achievements", kUtility);
 #endif
 
 #if defined(MOD_BALANCE_CORE)
 	// Must be after buildings because this calls from Buildings
-	PrefetchCollection(GC.getCorporationInfo(), "Corporations");
-	PrefetchCollection(GC.getContractInfo(), "Contracts");
+	PrefetchCollection(GC.getCorporationInfo(), "Corporations", kUtility);
+	PrefetchCollection(GC.getContractInfo(), "Contracts", kUtility);
 #endif
 
 	//Copy flavors into string array
 	{
-		CvDatabaseUtility kUtility;
 		CvString*& paFlavors = GC.getFlavorTypes();
 		const int iNumFlavors = kUtility.MaxRows("Flavors");
 		//GC.getNumFlavorTypes() = iNumFlavors;
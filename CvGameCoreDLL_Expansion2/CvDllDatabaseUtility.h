@@ -72,7 +72,7 @@ private:
 	bool SetStringList(CvString** ppszStringArray, int* piSize);
 
 	template<class T>
-	bool PrefetchCollection(std::vector<T*>& kCollection, const char* tableName);
+	bool PrefetchCollection(std::vector<T*>& kCollection, const char* tableName, CvDatabaseUtility& kUtility);
 
 	//
 	// special cases of set class info which don't use the template because of extra code they have
@@ -99,7 +99,7 @@ private:
 /////////////////////////// inlines / templates
 //////////////////////////////////////////////////////////////////////////
 template<class T>
-bool CvDllDatabaseUtility::PrefetchCollection(std::vector<T*>& kCollection, const char* tableName)
+bool CvDllDatabaseUtility::PrefetchCollection(std::vector<T*>& kCollection, const char* tableName, CvDatabaseUtility& kUtility)
 {
 	cvStopWatch kPerfTest(tableName, "xml-perf.log");
 
@@ -114,7 +114,6 @@ bool CvDllDatabaseUtility::PrefetchCollection(std::vector<T*>& kCollection, cons
 	//Repopulate!
 	size_t index = 0;
 	Database::Results kResults;
-	CvDatabaseUtility kUtility;
 
 	if(DB.SelectWhere(kResults, tableName, "ID > -1 ORDER BY ID"))
 	{
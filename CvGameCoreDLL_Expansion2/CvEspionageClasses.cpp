@@ -299,6 +299,7 @@ void CvPlayerEspionage::Reset()
 	for(uint ui = 0; ui < MAX_MAJOR_CIVS; ui++)
 	{
 		m_aiMaxTechCost[ui] = -1;
+		m_aiStealableTechListTurn[ui] = -1;
 		m_aHeistLocations[ui].clear();
 #if defined(MOD_BALANCE_CORE)
 		m_aiNumSpyActionsDone[ui] = 0;
@@ -3902,7 +3903,7 @@ bool pickSpyName(const CvCivilizationInfo& kCivInfo, CvEspionageSpy* pSpy)
 	if (iCivSpyNames > 0)
 	{
 #if defined(MOD_CORE_REDUCE_RANDOMNESS)
-		int iOffset = GC.getGame().getSmallFakeRandNum(iCivSpyNames, iCivSpyNames);
+		int iOffset = GC.getGame().getKeyedRandNum(iCivSpyNames, RAND_STREAM_GAME, NO_PLAYER, iCivSpyNames);
 #else
 		int iOffset = GC.getGame().getJonRandNum(iCivSpyNames, "Spy name offset");
 #endif
@@ -5642,13 +5643,38 @@ void CvPlayerEspionage::BuildStealableTechList(PlayerTypes ePlayer)
 		return;
 	}
 
+	// The list only depends on which techs the two teams know, so skip the rebuild if neither side gained or lost a tech this turn
+	int iTurn = GC.getGame().getGameTurn();
+	int iOurTechChanges = GET_TEAM(m_pPlayer->getTeam()).GetTeamTechs()->GetTechChangeCount();
+	int iTheirTechChanges = GET_TEAM(GET_PLAYER(ePlayer).getTeam()).GetTeamTechs()->GetTechChangeCount();
+	if(m_aiStealableTechListTurn[ePlayer] == iTurn && m_aiStealableTechListOurTechChanges[ePlayer] == iOurTechChanges && m_aiStealableTechListTheirTechChanges[ePlayer] == iTheirTechChanges && GET_PLAYER(ePlayer).isAlive())
+	{
+		// research costs can change without any tech changing hands (eg with the number of cities), so the most expensive tech is always looked up again
+		int iMaxTechCost = -1;
+		for(uint ui = 0; ui < m_aaPlayerStealableTechList[ePlayer].size(); ui++)
+		{
+			int iTechCost = m_pPlayer->GetPlayerTechs()->GetResearchCost(m_aaPlayerStealableTechList[ePlayer][ui]) * 100;
+			if(iTechCost > iMaxTechCost)
+			{
+				iMaxTechCost = iTechCost;
+			}
+		}
+		m_aiMaxTechCost[ePlayer] = iMaxTechCost;
+		return;
+	}
+
 	m_aaPlayerStealableTechList[ePlayer].clear();
+	m_aiStealableTechListTurn[ePlayer] = -1;
 
 	if(!GET_PLAYER(ePlayer).isAlive())
 	{
 		return;
 	}
 
+	m_aiStealableTechListTurn[ePlayer] = iTurn;
+	m_aiStealableTechListOurTechChanges[ePlayer] = iOurTechChanges;
+	m_aiStealableTechListTheirTechChanges[ePlayer] = iTheirTechChanges;
+
 	int iMaxTechCost = -1;
 
 	CvPlayerTechs* pMyPlayerTechs = m_pPlayer->GetPlayerTechs();
@@ -8282,6 +8308,10 @@ FDataStream& operator>>(FDataStream& loadFrom, CvPlayerEspionage& writeTo)
 	{
 		loadFrom >> writeTo.m_aiMaxTechCost[i];
 	}
+	for(uint ui = 0; ui < MAX_MAJOR_CIVS; ui++)
+	{
+		writeTo.m_aiStealableTechListTurn[ui] = -1;
+	}
 
 
 	int iNumCivs;
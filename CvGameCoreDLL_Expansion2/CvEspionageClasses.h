@@ -300,6 +300,10 @@ public:
 	PlayerTechList m_aaPlayerStealableTechList;
 	NumTechsToStealList m_aiNumTechsToStealList;
 	MaxTechCost m_aiMaxTechCost;
+	// what each stealable tech list was last built against (turn and both teams' tech change counters), not serialized
+	Firaxis::Array<int, MAX_MAJOR_CIVS> m_aiStealableTechListTurn;
+	Firaxis::Array<int, MAX_MAJOR_CIVS> m_aiStealableTechListOurTechChanges;
+	Firaxis::Array<int, MAX_MAJOR_CIVS> m_aiStealableTechListTheirTechChanges;
 	HeistLocationList m_aHeistLocations;
 	std::vector<SpyNotificationMessage> m_aSpyNotificationMessages; // cleared every turn after displayed for the player
 	std::vector<IntrigueNotificationMessage> m_aIntrigueNotificationMessages; // cleared only between games
@@ -30,6 +30,7 @@ CvFractal::CvFractal()
 	m_iFlags = 0;
 	m_iFracX = -1;
 	m_iFracY = -1;
+	m_bHeightHistogramValid = false;
 }
 
 CvFractal::~CvFractal()
@@ -51,6 +52,7 @@ void CvFractal::reset()
 	m_iFlags = 0;
 	m_iFracX = -1;
 	m_iFracY = -1;
+	m_bHeightHistogramValid = false;
 }
 
 void CvFractal::fracInit(int iNewXs, int iNewYs, int iGrain, CvRandom& random, int iFlags, CvFractal* pRifts, int iFracXExp/*=7*/, int iFracYExp/*=6*/)
@@ -339,7 +341,6 @@ int CvFractal::getHeightFromPercent(int iPercent)
 	int iLowerBound;
 	int iUpperBound;
 	int iSum;
-	int iX, iY;
 
 	iLowerBound = 0;
 	iUpperBound = 255;
@@ -347,20 +348,16 @@ int CvFractal::getHeightFromPercent(int iPercent)
 	iPercent = range(iPercent, 0, 100);
 	iEstimate = 255 * iPercent / 100;
 
+	// map scripts ask for many thresholds on the same fractal, so count the heights once rather than once per probe
+	if(!m_bHeightHistogramValid)
+	{
+		buildHeightHistogram();
+	}
+
 	while(iEstimate != iLowerBound)
 	{
-		iSum = 0;
+		iSum = m_aiHeightsBelow[iEstimate];
 
-		for(iX = 0; iX < m_iFracX; iX++)
-		{
-			for(iY = 0; iY < m_iFracY; iY++)
-			{
-				if(m_aaiFrac[iX][iY] < iEstimate)
-				{
-					iSum++;
-				}
-			}
-		}
 		if(((100 * iSum) / (m_iFracX * m_iFracY)) > iPercent)
 		{
 			iUpperBound = iEstimate;
@@ -378,6 +375,42 @@ int CvFractal::getHeightFromPercent(int iPercent)
 
 // Protected Functions...
 
+void CvFractal::buildHeightHistogram()
+{
+	int aiCount[256];
+	int iBelowAll = 0;
+	int iI;
+
+	for(iI = 0; iI < 256; iI++)
+	{
+		aiCount[iI] = 0;
+	}
+
+	for(int iX = 0; iX < m_iFracX; iX++)
+	{
+		for(int iY = 0; iY < m_iFracY; iY++)
+		{
+			const int iHeight = m_aaiFrac[iX][iY];
+			if(iHeight < 0)
+			{
+				iBelowAll++;
+			}
+			else if(iHeight < 256)
+			{
+				aiCount[iHeight]++;
+			}
+		}
+	}
+
+	m_aiHeightsBelow[0] = iBelowAll;
+	for(iI = 1; iI < 256; iI++)
+	{
+		m_aiHeightsBelow[iI] = m_aiHeightsBelow[iI - 1] + aiCount[iI - 1];
+	}
+
+	m_bHeightHistogramValid = true;
+}
+
 void CvFractal::tectonicAction(CvFractal* pRifts)  //  Assumes FRAC_WRAP_X is on.
 {
 	//int iRift1x = (m_iFracX / 4);
@@ -433,6 +466,7 @@ struct VoronoiSeed
 void CvFractal::ridgeBuilder(CvRandom& random, int iNumVoronoiSeeds, int iRidgeFlags, int iBlendRidge, int iBlendFract)
 {
 	// this will use a modified Voronoi system to give the appearance of mountain ranges
+	m_bHeightHistogramValid = false;
 
 	iNumVoronoiSeeds = std::max(iNumVoronoiSeeds,3); // make sure that we have at least 3
 
@@ -91,6 +91,12 @@ protected:
 	int m_iYInc;
 
 	int m_aaiFrac[FRACTAL_MAX_DIMS+1][FRACTAL_MAX_DIMS+1]; //[FRAC_X + 1][FRAC_Y + 1];
+
+	// m_aiHeightsBelow[i] is the number of fractal cells with a height below i, built on demand by getHeightFromPercent
+	bool m_bHeightHistogramValid;
+	int m_aiHeightsBelow[256];
+	void buildHeightHistogram();
+
 	void fracInitInternal(int iNewXs, int iNewYs, int iGrain, CvRandom& random, byte* pbyHints, int iHintsLength, int iFlags, CvFractal* pRifts, int iFracXExp, int iFracYExp);
 	void tectonicAction(CvFractal* pRifts);
 	int yieldX(int iBadX);
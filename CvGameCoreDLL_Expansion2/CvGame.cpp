@@ -1882,7 +1882,7 @@ void CvGame::updateScore(bool bForce)
 
 		CvPlayerAI& player = GET_PLAYER(eBestPlayer);
 
-		unsigned int uiDataSetIndex = player.getReplayDataSetIndex("REPLAYDATASET_SCORE");
+		unsigned int uiDataSetIndex = player.getReplayDataSetIndex(CvPlayer::REPLAYDATASET_SCORE);
 		player.setReplayDataValue(uiDataSetIndex, getGameTurn(), iBestScore);
 	}
 
@@ -5824,7 +5824,7 @@ Localization::String CvGame::GetDiploResponse(const char* szLeader, const char*
 
     if(!probabilities.empty())
     {
-		tempRand = getSmallFakeRandNum(totbias, GC.getGame().getGameTurn());
+		tempRand = getKeyedRandNum(totbias, RAND_STREAM_GAME, NO_PLAYER, GC.getGame().getGameTurn());
         for (choice=0; choice<biasList.size(); choice++){
             if(tempRand < biasList[choice]){
                 break;
@@ -5855,7 +5855,7 @@ Localization::String CvGame::GetDiploResponse(const char* szLeader, const char*
 
     if(!probabilities.empty())
     {
-		tempRand = getSmallFakeRandNum(totbias, GC.getGame().getGameTurn());
+		tempRand = getKeyedRandNum(totbias, RAND_STREAM_GAME, NO_PLAYER, GC.getGame().getGameTurn());
         for (choice=0; choice<biasList.size(); choice++){
             if(tempRand < biasList[choice]){
                 break;
@@ -8909,7 +8909,7 @@ UnitTypes CvGame::GetRandomUniqueUnitType(bool bIncludeCivsInGame, bool bInclude
 #if defined(MOD_BALANCE_CORE)
 
 #if defined(MOD_CORE_REDUCE_RANDOMNESS)
-		int iRandom = getSmallFakeRandNum(5, eLoopUnit);
+		int iRandom = getKeyedRandNum(5, RAND_STREAM_GAME, NO_PLAYER, eLoopUnit);
 #else
 		int iRandom = getJonRandNum(5, "Random Value For Gift");
 #endif
@@ -10013,34 +10013,21 @@ int CvGame::getAsyncRandNum(int iNum, const char* pszLog)
 #endif
 }
 
-#if defined(MOD_CORE_REDUCE_RANDOMNESS)
 //	--------------------------------------------------------------------------------
-// Get a fake random number which depends only on game state
-// for small numbers (e.g. direction rolls) this should be good enough
-// most importantly, it should reduce desyncs in multiplayer
-
-int CvGame::getSmallFakeRandNum(int iNum, const CvPlot& input)
+/// Get a synchronous random number in the range of 0...iNum-1
+/// Each (stream, player, object) combination gets its own sequence over the turns,
+/// so the result does not depend on how many other random numbers were drawn before.
+int CvGame::getKeyedRandNum(int iNum, KeyedRandStreamTypes eStream, PlayerTypes ePlayer, int iObjectID)
 {
-	int iFake = input.getX() * 17 + input.getY() * 23 + getGameTurn()*abs(input.getX() - input.getY()) + getGameTurn();
-	
-	if (iNum>0)
-		return abs(iFake*iFake) % iNum;
-	else
-		return (-1) * (abs(iFake*iFake) % (-iNum));
-}
+	unsigned long long ullSeed = CvPreGame::syncRandomSeed();
+	unsigned long ulResult = CvRandom::getKeyed((unsigned long)abs(iNum), ullSeed, (unsigned long)getGameTurn(), (unsigned long)eStream, (unsigned long)ePlayer, (unsigned long)iObjectID);
 
-int CvGame::getSmallFakeRandNum(int iNum, int iExtraSeed)
-{
-	int iFake = getGameTurn() + abs(iExtraSeed);
+	if (iNum > 0)
+		return (int)ulResult;
 
-	if (iNum>0)
-		return abs(iFake*iFake) % iNum;
-	else
-		return (-1) * (abs(iFake*iFake) % (-iNum));
+	return (int)ulResult*(-1);
 }
 
-#endif
-
 //	--------------------------------------------------------------------------------
 int CvGame::calculateSyncChecksum()
 {
@@ -12693,18 +12680,9 @@ int CvGame::GetNumArchaeologySites() const
 		return -1;
 	}
 
-	int iRtnValue = 0;
-	int iPlotLoop;
-	CvPlot *pPlot;
-	for (iPlotLoop = 0; iPlotLoop < GC.getMap().numPlots(); iPlotLoop++)
-	{
-		pPlot = GC.getMap().plotByIndexUnchecked(iPlotLoop);
-		if (pPlot->getResourceType() == GC.getARTIFACT_RESOURCE())
-		{
-			iRtnValue++;
-		}
-	}
-	return iRtnValue;
+	// the map keeps a per-plot count of each resource
+	ResourceTypes eArtifact = (ResourceTypes)GC.getARTIFACT_RESOURCE();
+	return (eArtifact != NO_RESOURCE) ? GC.getMap().getNumResources(eArtifact) : 0;
 }
 //	--------------------------------------------------------------------------------
 int CvGame::GetNumHiddenArchaeologySites() const
@@ -12714,18 +12692,8 @@ int CvGame::GetNumHiddenArchaeologySites() const
 		return -1;
 	}
 
-	int iRtnValue = 0;
-	int iPlotLoop;
-	CvPlot *pPlot;
-	for (iPlotLoop = 0; iPlotLoop < GC.getMap().numPlots(); iPlotLoop++)
-	{
-		pPlot = GC.getMap().plotByIndexUnchecked(iPlotLoop);
-		if (pPlot->getResourceType() == GC.getHIDDEN_ARTIFACT_RESOURCE())
-		{
-			iRtnValue++;
-		}
-	}
-	return iRtnValue;
+	ResourceTypes eHiddenArtifact = (ResourceTypes)GC.getHIDDEN_ARTIFACT_RESOURCE();
+	return (eHiddenArtifact != NO_RESOURCE) ? GC.getMap().getNumResources(eHiddenArtifact) : 0;
 }
 
 //	--------------------------------------------------------------------------------
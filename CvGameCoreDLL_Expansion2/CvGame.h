@@ -39,6 +39,18 @@ class CvGameCorporations;
 class CvGameContracts;
 #endif
 
+// Streams for CvGame::getKeyedRandNum, so draws made by different subsystems never share a sequence
+enum KeyedRandStreamTypes
+{
+	RAND_STREAM_BARBARIANS,
+	RAND_STREAM_CITIES,
+	RAND_STREAM_UNITS,
+	RAND_STREAM_DIPLOMACY_AI,
+	RAND_STREAM_MILITARY_AI,
+	RAND_STREAM_MINOR_CIVS,
+	RAND_STREAM_GAME,
+};
+
 class CvGameInitialItemsOverrides
 {
 public:
@@ -434,11 +446,8 @@ public:
 	int getJonRandNumVA(int iNum, const char* pszLog, ...);
 	int getAsyncRandNum(int iNum, const char* pszLog);
 
-#if defined(MOD_CORE_REDUCE_RANDOMNESS)
-	//get random number from gamestate without a seed in the generator
-	int	getSmallFakeRandNum(int iNum, const CvPlot& input);
-	int	getSmallFakeRandNum(int iNum, int iExtraSeed);
-#endif
+	//synchronous random number keyed by (game seed, turn, stream, player, object), independent of the order of calls
+	int getKeyedRandNum(int iNum, KeyedRandStreamTypes eStream, PlayerTypes ePlayer, int iObjectID);
 
 	int calculateSyncChecksum();
 	int calculateOptionsChecksum();
@@ -228,6 +228,7 @@ CvPlot* CvHomelandAI::GetBestExploreTarget(const CvUnit* pUnit, int nMinCandidat
 
 	int iBestPlotScore = 100; //limits initial search range to 10 turns
 	CvPlot* pBestPlot = NULL;
+	int iMaxRating = 1;
 
 	//sort by distance to capital or to unit
 	int iRefX = pUnit ? pUnit->getX() : m_pPlayer->getCapitalCity()->getX();
@@ -263,61 +264,79 @@ CvPlot* CvHomelandAI::GetBestExploreTarget(const CvUnit* pUnit, int nMinCandidat
 		int iDistY = abs( vExplorePlots[ui].pPlot->getY() - iRefY );
 		int iDist2 = (iDistX*iDistX)+(iDistY*iDistY);
 
-		vPlotsByDistance.push_back( std::make_pair( (iDist2*100)/vExplorePlots[ui].score, vExplorePlots[ui]) );
+		//the rating does not depend on the search range, so do this only once
+		SPlotWithScore candidate = vExplorePlots[ui];
+
+		//discourage embarking
+		if (pUnit->getDomainType()==DOMAIN_LAND && candidate.pPlot->isWater())
+			candidate.score /= 2;
+
+		//try to explore close to our cities first to find potential settle spots
+		int iCityDistance = m_pPlayer->GetCityDistanceInEstimatedTurns(candidate.pPlot);
+		candidate.score = max(1, candidate.score-iCityDistance); 
+
+		iMaxRating = max(iMaxRating, candidate.score);
+		vPlotsByDistance.push_back( std::make_pair( (iDist2*100)/vExplorePlots[ui].score, candidate) );
 	}
 
+	if (vPlotsByDistance.empty())
+		return NULL;
+
 	//sorts ascending by the first element of the iterator ... which is our distance. nice.
 	std::stable_sort(vPlotsByDistance.begin(), vPlotsByDistance.end());
 
-	//see where our scout can go within the allowed turns
-	ReachablePlots reachablePlots;
-	if (pUnit)
-	{
-		SPathFinderUserData data(pUnit, CvUnit::MOVEFLAG_TERRITORY_NO_ENEMY | CvUnit::MOVEFLAG_MAXIMIZE_EXPLORE, iMaxTurns);
-		data.ePathType = PT_UNIT_REACHABLE_PLOTS;
-		reachablePlots = GC.GetPathFinder().GetPlotsInReach(iRefX, iRefY, data);
-	}
+	//no candidate can beat the initial score if it's further away than this
+	int iMaxUsefulTurns = (1000*iMaxRating) / iBestPlotScore;
 
-	int iValidCandidates = 0;
-	for (size_t idx=0; idx<vPlotsByDistance.size(); idx++)
+	//widen the search in stages, a long range search is expensive and usually not needed.
+	//a stage which would not reach any further than the previous one cannot find anything new, so stop there.
+	const int aiStageTurns[] = { 8, 23, 42 };
+	int iSearchedTurns = 0;
+	for (int iStage = 0; iStage < 3 && !pBestPlot; iStage++)
 	{
-		//after looking at the N closest candidates
-		//if we found something, bail
-		if (pBestPlot && iValidCandidates>nMinCandidates)
+		int iTurns = min( min(aiStageTurns[iStage], iMaxTurns), iMaxUsefulTurns );
+		if (iTurns <= iSearchedTurns)
 			break;
+		iSearchedTurns = iTurns;
 
-		CvPlot* pEvalPlot = vPlotsByDistance[idx].second.pPlot;
-		int iRating = vPlotsByDistance[idx].second.score;
+		//see where our scout can go within the allowed turns
+		SPathFinderUserData data(pUnit, CvUnit::MOVEFLAG_TERRITORY_NO_ENEMY | CvUnit::MOVEFLAG_MAXIMIZE_EXPLORE, iTurns);
+		data.ePathType = PT_UNIT_REACHABLE_PLOTS;
+		ReachablePlots reachablePlots = GC.GetPathFinder().GetPlotsInReach(iRefX, iRefY, data);
 
-		//discourage embarking
-		if (pUnit->getDomainType()==DOMAIN_LAND && pEvalPlot->isWater())
-			iRating /= 2;
+		int iValidCandidates = 0;
+		for (size_t idx=0; idx<vPlotsByDistance.size(); idx++)
+		{
+			//after looking at the N closest candidates
+			//if we found something, bail
+			if (pBestPlot && iValidCandidates>nMinCandidates)
+				break;
 
-		//try to explore close to our cities first to find potential settle spots
-		int iCityDistance = m_pPlayer->GetCityDistanceInEstimatedTurns(pEvalPlot);
-		iRating = max(1, iRating-iCityDistance); 
+			CvPlot* pEvalPlot = vPlotsByDistance[idx].second.pPlot;
+			int iRating = vPlotsByDistance[idx].second.score;
 
-		//reverse the score calculation below to get an upper bound on the distance
-		//minus one because we want to do better
-		int iMaxDistance = (1000*iRating) / max(1,iBestPlotScore) - 1;
+			//reverse the score calculation below to get an upper bound on the distance
+			//minus one because we want to do better
+			int iMaxDistance = (1000*iRating) / max(1,iBestPlotScore) - 1;
 
-		//is there a chance we can reach the plot within the required number of turns? (assuming no roads)
-		if( sqrt((float)vPlotsByDistance[idx].first) > (iMaxDistance*pUnit->baseMoves()) )
-			continue;
+			//is there a chance we can reach the plot within the required number of turns? (assuming no roads)
+			if( sqrt((float)vPlotsByDistance[idx].first) > (iMaxDistance*pUnit->baseMoves()) )
+				continue;
 
-		ReachablePlots::iterator it = reachablePlots.find(pEvalPlot->GetPlotIndex());
-		if (it==reachablePlots.end())
-			continue;
+			ReachablePlots::iterator it = reachablePlots.find(pEvalPlot->GetPlotIndex());
+			if (it==reachablePlots.end())
+				continue;
 
-		int iDistance = it->iTurns;
-		int iPlotScore = (1000 * iRating) / max(1,iDistance);
+			int iDistance = it->iTurns;
+			int iPlotScore = (1000 * iRating) / max(1,iDistance);
 
-		iValidCandidates++;
+			iValidCandidates++;
 
-		if (iPlotScore>iBestPlotScore)
-		{
-			pBestPlot = pEvalPlot;
-			iBestPlotScore = iPlotScore;
+			if (iPlotScore>iBestPlotScore)
+			{
+				pBestPlot = pEvalPlot;
+				iBestPlotScore = iPlotScore;
+			}
 		}
 	}
 
@@ -3419,7 +3438,7 @@ void CvHomelandAI::ExecuteFirstTurnSettlerMoves()
 					CvPlot* pLoopPlotSearch = NULL;
 					for (int iI = 0; iI < 3; iI++)
 					{
-						int iRandomDirection = GC.getGame().getSmallFakeRandNum(NUM_DIRECTION_TYPES, iI);
+						int iRandomDirection = GC.getGame().getKeyedRandNum(NUM_DIRECTION_TYPES, RAND_STREAM_MILITARY_AI, m_pPlayer->GetID(), iI);
 						pLoopPlotSearch = plotDirection(pUnit->plot()->getX(), pUnit->plot()->getY(), ((DirectionTypes)iRandomDirection));
 						if (pLoopPlotSearch != NULL)
 						{
@@ -3657,7 +3676,7 @@ void CvHomelandAI::ExecuteExplorerMoves(bool bSecondPass)
 					}
 				}
 
-				int iRandom = GC.getGame().getSmallFakeRandNum(47,*pEvalPlot);
+				int iRandom = GC.getGame().getKeyedRandNum(47, RAND_STREAM_MILITARY_AI, m_pPlayer->GetID(), pEvalPlot->GetPlotIndex());
 				int iTotalScore = iScoreBase+iScoreExtra+iScoreBonus+iRandom;
 
 				//careful with plots that are too dangerous
@@ -3698,16 +3717,8 @@ void CvHomelandAI::ExecuteExplorerMoves(bool bSecondPass)
 		//if we didn't find a worthwhile plot among our adjacent plots, check the global targets
 		if (!pBestPlot && pUnit->movesLeft() > 0)
 		{
-			//check at least 5 candidates
-			pBestPlot = GetBestExploreTarget(pUnit, 5, 8);
-
-			//if nothing found, retry with larger distance - but this is slow
-			if (!pBestPlot)
-				pBestPlot = GetBestExploreTarget(pUnit, 5, 23);
-
-			//if still nothing found, retry with even larger distance - but this is sloooooow
-			if (!pBestPlot)
-				pBestPlot = GetBestExploreTarget(pUnit, 5, 42);
+			//check at least 5 candidates, the search range is widened as needed
+			pBestPlot = GetBestExploreTarget(pUnit, 5, 42);
 
 			//verify that we don't move into danger ...
 			if (pBestPlot)
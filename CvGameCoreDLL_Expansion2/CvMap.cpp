@@ -436,7 +436,7 @@ CvPlot** CvMap::getNeighborsShuffled(const CvPlot* pPlot)
 		{ 3, 0, 4, 1, 2, 5 },
 		{ 1, 2, 4, 5, 0, 3 } };
 
-	int iShuffleType = GC.getGame().getSmallFakeRandNum(3, *pPlot);
+	int iShuffleType = GC.getGame().getKeyedRandNum(3, RAND_STREAM_GAME, NO_PLAYER, pPlot->GetPlotIndex());
 	int iBaseIndex = plotNum(pPlot->getX(), pPlot->getY())*(NUM_DIRECTION_TYPES + 2);
 
 	for (int i = 0; i < NUM_DIRECTION_TYPES; i++)
@@ -546,6 +546,9 @@ void CvMap::reset(CvMapInitData* pInitInfo)
 		}
 	}
 
+	m_vPlotsWithImprovement.clear();
+	m_vPlotsWithImprovement.resize(GC.getNumImprovementInfos());
+
 	m_areas.RemoveAll();
 	m_landmasses.RemoveAll();
 
@@ -1310,6 +1313,50 @@ void CvMap::setNumResources(ResourceTypes eIndex)
 	}
 }
 #endif
+//	--------------------------------------------------------------------------------
+/// All plots which have the given improvement, ordered by plot index
+const std::vector<int>& CvMap::GetPlotsWithImprovement(ImprovementTypes eImprovement) const
+{
+	CvAssertMsg(eImprovement >= 0 && eImprovement < (int)m_vPlotsWithImprovement.size(), "eImprovement is expected to be within maximum bounds (invalid Index)");
+	return m_vPlotsWithImprovement[eImprovement];
+}
+
+//	--------------------------------------------------------------------------------
+/// Keep the improvement index up to date, called from CvPlot::setImprovementType
+void CvMap::PlotImprovementChanged(int iPlotIndex, ImprovementTypes eOldImprovement, ImprovementTypes eNewImprovement)
+{
+	if(eOldImprovement != NO_IMPROVEMENT && eOldImprovement < (int)m_vPlotsWithImprovement.size())
+	{
+		std::vector<int>& vPlots = m_vPlotsWithImprovement[eOldImprovement];
+		std::vector<int>::iterator it = std::lower_bound(vPlots.begin(), vPlots.end(), iPlotIndex);
+		if(it != vPlots.end() && *it == iPlotIndex)
+			vPlots.erase(it);
+	}
+
+	if(eNewImprovement != NO_IMPROVEMENT && eNewImprovement < (int)m_vPlotsWithImprovement.size())
+	{
+		std::vector<int>& vPlots = m_vPlotsWithImprovement[eNewImprovement];
+		std::vector<int>::iterator it = std::lower_bound(vPlots.begin(), vPlots.end(), iPlotIndex);
+		if(it == vPlots.end() || *it != iPlotIndex)
+			vPlots.insert(it, iPlotIndex);
+	}
+}
+
+//	--------------------------------------------------------------------------------
+/// Rebuild the improvement index from scratch (after loading)
+void CvMap::UpdatePlotsWithImprovement()
+{
+	m_vPlotsWithImprovement.clear();
+	m_vPlotsWithImprovement.resize(GC.getNumImprovementInfos());
+
+	for(int iI = 0; iI < numPlots(); iI++)
+	{
+		ImprovementTypes eImprovement = m_pMapPlots[iI].getImprovementType();
+		if(eImprovement != NO_IMPROVEMENT && eImprovement < (int)m_vPlotsWithImprovement.size())
+			m_vPlotsWithImprovement[eImprovement].push_back(iI);
+	}
+}
+
 //	--------------------------------------------------------------------------------
 int CvMap::getNumResourcesOnLand(ResourceTypes eIndex)
 {
@@ -1426,6 +1473,9 @@ void CvMap::recalculateAreas()
 	calculateAreas();
 
 	recalculateLandmasses();
+
+	//area ids are part of the same area path types, cached generic paths may be stale now
+	GC.GetStepFinder().ClearPathCache();
 }
 
 
@@ -1498,6 +1548,8 @@ void CvMap::Read(FDataStream& kStream)
 		}
 	}
 
+	UpdatePlotsWithImprovement();
+
 	// call the read of the free list CvArea class allocations
 	kStream >> m_areas;
 
@@ -213,6 +213,11 @@ public:
 	int getNumResourcesOnLand(ResourceTypes eIndex);
 	void changeNumResourcesOnLand(ResourceTypes eIndex, int iChange);
 
+	// Improvements
+	const std::vector<int>& GetPlotsWithImprovement(ImprovementTypes eImprovement) const;
+	void PlotImprovementChanged(int iPlotIndex, ImprovementTypes eOldImprovement, ImprovementTypes eNewImprovement);
+	void UpdatePlotsWithImprovement();
+
 	/// Plot accessors
 	__forceinline CvPlot* plotByIndex(int iIndex) const
 	{
@@ -339,6 +344,8 @@ protected:
 	int* m_paiNumResource;
 	int* m_paiNumResourceOnLand;
 
+	std::vector< std::vector<int> > m_vPlotsWithImprovement; // sorted plot indices per improvement, don't serialize me
+
 	CvPlot* m_pMapPlots;
 #if defined(MOD_BALANCE_CORE)
 	CvPlot** m_pPlotNeighbors;			//precomputed neighbors for each plot
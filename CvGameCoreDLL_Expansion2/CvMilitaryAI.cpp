@@ -327,6 +327,8 @@ void CvMilitaryAI::Reset()
 	m_cachedTargets.clear();
 	m_cachedLandDistances.clear();
 	m_cachedWaterDistances.clear();
+	m_cachedCitySituations.clear();
+	m_iCachedCitySituationsTurn = -1;
 
 	m_iNumLandUnits = 0;
 	m_iNumRangedLandUnits = 0;
@@ -1417,6 +1419,76 @@ void CvMilitaryAI::RefreshDistanceCaches()
 	m_cachedWaterDistances.clear();
 }
 
+SCachedCitySituation& CvMilitaryAI::GetCachedCitySituation(CvCity* pCity)
+{
+	if (m_iCachedCitySituationsTurn != GC.getGame().getGameTurn())
+	{
+		m_cachedCitySituations.clear();
+		m_iCachedCitySituationsTurn = GC.getGame().getGameTurn();
+	}
+
+	return m_cachedCitySituations[pCity->plot()->GetPlotIndex()];
+}
+
+/// Power of the combat units around a city (boosted if a general is nearby), computed once per turn
+int CvMilitaryAI::GetCachedCityNeighborhoodPower(CvCity* pCity)
+{
+	if (!pCity)
+		return 0;
+
+	SCachedCitySituation& situation = GetCachedCitySituation(pCity);
+	if (situation.iNeighborhoodPower != -1)
+		return situation.iNeighborhoodPower;
+
+	int iPower = 0;
+	bool bGeneralInTheVicinity = false;
+	int iAuraEffectChange = 0;
+	for(int iI = 0; iI < pCity->GetNumWorkablePlots(); iI++)
+	{
+		CvPlot* pLoopPlot = pCity->GetCityCitizens()->GetCityPlotFromIndex(iI);
+
+		if(pLoopPlot != NULL)
+		{
+			if(pLoopPlot->getNumUnits() > 0)
+			{
+				CvUnit* pLoopUnit = pLoopPlot->getUnitByIndex(0);
+				if(pLoopUnit != NULL)
+				{
+					if (pLoopUnit->IsCombatUnit())
+					{
+						iPower += pLoopUnit->GetPower();
+					}
+					if (!bGeneralInTheVicinity && pLoopUnit->IsNearGreatGeneral(iAuraEffectChange, pLoopUnit->plot()))
+					{
+						bGeneralInTheVicinity = true;
+					}
+				}
+			}
+		}
+	}
+	if (bGeneralInTheVicinity)
+	{
+		iPower *= 12;
+		iPower /= 10;
+	}
+
+	situation.iNeighborhoodPower = iPower;
+	return iPower;
+}
+
+/// Are there at least 8 non-occupied plots around this city for our army? Computed once per turn
+bool CvMilitaryAI::GetCachedCityHasDeploymentRoom(CvCity* pCity)
+{
+	if (!pCity)
+		return false;
+
+	SCachedCitySituation& situation = GetCachedCitySituation(pCity);
+	if (situation.iHasDeploymentRoom == -1)
+		situation.iHasDeploymentRoom = TacticalAIHelpers::CountDeploymentPlots(m_pPlayer->getTeam(), pCity->plot(), 8, 3) ? 1 : 0;
+
+	return situation.iHasDeploymentRoom == 1;
+}
+
 bool CvMilitaryAI::IsCurrentAttackTarget(CvCity* pCity)
 {
 	if (!pCity || pCity->getOwner()==m_pPlayer->GetID())
@@ -1693,105 +1765,20 @@ CvMilitaryTarget CvMilitaryAI::FindBestAttackTarget(AIOperationTypes eAIOperatio
 	CvPlayer &kEnemy = GET_PLAYER(eEnemy);
 
 	// Estimate the relative strength of our strongest city (this is purely beneficial from figuring out which of their cities is weakest, as this shouldn't really affect muster)
+	// We only want highest because we're just trying to figure out which of their cities is the weakest.
+	// City powers are cached for the turn, since we get here for every enemy and every operation type.
 	int iBestPower = 0;
 	for (pFriendlyCity = m_pPlayer->firstCity(&iFriendlyLoop); pFriendlyCity != NULL; pFriendlyCity = m_pPlayer->nextCity(&iFriendlyLoop))
 	{
-		int iPower = 0;
-		bool bGeneralInTheVicinity = false;
-		int iAuraEffectChange = 0;
-		for(int iI = 0; iI < pFriendlyCity->GetNumWorkablePlots(); iI++)
-		{
-			CvPlot* pLoopPlot = pFriendlyCity->GetCityCitizens()->GetCityPlotFromIndex(iI);
-
-			if(pLoopPlot != NULL)
-			{
-				if(pLoopPlot->getNumUnits() > 0)
-				{
-					CvUnit* pLoopUnit = pLoopPlot->getUnitByIndex(0);
-					if(pLoopUnit != NULL)
-					{
-						if (pLoopUnit->IsCombatUnit())
-						{
-							iPower += pLoopUnit->GetPower();
-						}
-						if (!bGeneralInTheVicinity && pLoopUnit->IsNearGreatGeneral(iAuraEffectChange, pLoopUnit->plot()))
-						{
-							bGeneralInTheVicinity = true;
-						}
-					}
-				}
-			}
-		}
-		if (bGeneralInTheVicinity)
-		{
-			iPower *= 12;
-			iPower /= 10;
-		}
-		if(iPower > iBestPower)
-		{
-			iBestPower = iPower;
-		}
-	}
-	//Now set our scratch value for all cities. We only want highest because we're just trying to figure out which of their cities is the weakest.
-	if(iBestPower > 0)
-	{
-		for (pFriendlyCity = m_pPlayer->firstCity(&iFriendlyLoop); pFriendlyCity != NULL; pFriendlyCity = m_pPlayer->nextCity(&iFriendlyLoop))
-		{
-			pFriendlyCity->iScratch = iBestPower;
-		}
-	}
-	for(pEnemyCity = kEnemy.firstCity(&iEnemyLoop); pEnemyCity != NULL; pEnemyCity = kEnemy.nextCity(&iEnemyLoop))
-	{
-		CvPlot* pPlot = pEnemyCity->plot();
-		//If there aren't at least 8 non-occupied plots around this city, abort.
-		if(pPlot != NULL && !TacticalAIHelpers::CountDeploymentPlots(m_pPlayer->getTeam(), pPlot, 8, 3))
-		{
-			continue;
-		}
-		if(pPlot->isRevealed(m_pPlayer->getTeam()))
-		{
-			int iPower = 0;
-			bool bGeneralInTheVicinity = false;
-			int iAuraEffectChange = 0;
-			for(int iI = 0; iI < pEnemyCity->GetNumWorkablePlots(); iI++)	
-			{
-				CvPlot* pLoopPlot = pEnemyCity->GetCityCitizens()->GetCityPlotFromIndex(iI);
-
-				if(pLoopPlot != NULL)
-				{
-					if(pLoopPlot->getNumUnits() > 0)
-					{
-						CvUnit* pLoopUnit = pLoopPlot->getUnitByIndex(0);
-						if(pLoopUnit != NULL)
-						{
-							if (pLoopUnit->IsCombatUnit())
-							{
-								iPower += pLoopUnit->GetPower();
-							}
-							if (!bGeneralInTheVicinity && pLoopUnit->IsNearGreatGeneral(iAuraEffectChange, pLoopUnit->plot()))
-							{
-								bGeneralInTheVicinity = true;
-							}
-						}
-					}
-				}
-			}
-			if (bGeneralInTheVicinity)
-			{
-				iPower *= 12;
-				iPower /= 10;
-			}
-			pEnemyCity->iScratch = iPower;
-		}
+		iBestPower = max(iBestPower, GetCachedCityNeighborhoodPower(pFriendlyCity));
 	}
 
 	// Build a list of all the possible start city/target city pairs
 	CvWeightedVector<CvMilitaryTarget, SAFE_ESTIMATE_NUM_CITIES, true> prelimWeightedTargetList;
 	for(pFriendlyCity = m_pPlayer->firstCity(&iFriendlyLoop); pFriendlyCity != NULL; pFriendlyCity = m_pPlayer->nextCity(&iFriendlyLoop))
 	{
-		CvPlot* pPlot = pFriendlyCity->plot();
 		//If there aren't at least 8 non-occupied plots around this city, abort.
-		if(pPlot != NULL && !TacticalAIHelpers::CountDeploymentPlots(m_pPlayer->getTeam(), pPlot, 8, 3))
+		if(!GetCachedCityHasDeploymentRoom(pFriendlyCity))
 		{
 			continue;
 		}
@@ -1802,7 +1789,7 @@ CvMilitaryTarget CvMilitaryAI::FindBestAttackTarget(AIOperationTypes eAIOperatio
 				CvMilitaryTarget target;
 				target.m_pMusterCity = pFriendlyCity;
 				target.m_pTargetCity = pEnemyCity;
-				target.iStrengthRatioTimes100 = ((pFriendlyCity->iScratch + pFriendlyCity->GetPower()) * 100) / (pEnemyCity->iScratch + pEnemyCity->GetPower() + 1);
+				target.iStrengthRatioTimes100 = ((iBestPower + pFriendlyCity->GetPower()) * 100) / (GetCachedCityNeighborhoodPower(pEnemyCity) + pEnemyCity->GetPower() + 1);
 
 				if (target.iStrengthRatioTimes100 <= 50)
 				{
@@ -3839,8 +3826,9 @@ void CvMilitaryAI::DoNuke(PlayerTypes ePlayer)
 				if (bRollForNuke)
 				{
 					int iFlavorNuke = m_pPlayer->GetGrandStrategyAI()->GetPersonalityAndGrandStrategy((FlavorTypes)GC.getInfoTypeForString("FLAVOR_USE_NUKE"));
-					int iRoll = GC.getGame().getSmallFakeRandNum(10, ePlayer);
-					int iRoll2 = GC.getGame().getSmallFakeRandNum(10, ePlayer);
+					int iRoll = GC.getGame().getKeyedRandNum(10, RAND_STREAM_MILITARY_AI, m_pPlayer->GetID(), ePlayer);
+					//second roll needs its own key, otherwise it just repeats the first one
+					int iRoll2 = GC.getGame().getKeyedRandNum(10, RAND_STREAM_MILITARY_AI, m_pPlayer->GetID(), MAX_PLAYERS + ePlayer);
 					if (iRoll < iFlavorNuke && iRoll2 < iFlavorNuke)
 					{
 						bLaunchNuke = true;
@@ -6738,7 +6726,7 @@ CvPlot* MilitaryAIHelpers::GetCoastalPlotNearPlot(CvPlot *pTarget)
 		{ 0,5,6,3,2,4,1,14,13,17,16,15,11,8,9,18,12,7,10 },
 		{ 0,4,1,5,2,3,6,14,8,15,12,18,16,9,7,11,10,13,17 },
 		{ 0,6,3,5,2,1,4,18,15,16,14,12,17,8,7,10,9,13,11 } };
-	int iShuffleType = GC.getGame().getSmallFakeRandNum(3, *pTarget);
+	int iShuffleType = GC.getGame().getKeyedRandNum(3, RAND_STREAM_MILITARY_AI, NO_PLAYER, pTarget->GetPlotIndex());
 
 	for(int iI = RING0_PLOTS; iI < RING2_PLOTS; iI++)
 	{
@@ -173,6 +173,21 @@ struct SCachedTarget
 typedef std::map<PlayerTypes,std::map<AIOperationTypes,SCachedTarget>> CachedTargetsMap;
 typedef std::map<CvCity*, std::map<CvCity*, int>> CachedDistancesMap;
 
+struct SCachedCitySituation
+{
+	SCachedCitySituation() :
+		iNeighborhoodPower(-1),
+		iHasDeploymentRoom(-1)
+	{
+	}
+
+	int iNeighborhoodPower;	//-1 until computed
+	int iHasDeploymentRoom;	//-1 until computed, then 0 or 1
+};
+
+//keyed by the city's plot index, so a razed city can't hand its entry to a new one
+typedef std::map<int, SCachedCitySituation> CachedCitySituationsMap;
+
 #endif
 
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -261,6 +276,9 @@ public:
 	int GetCachedAttackTargetWaterDistance(CvCity* pCity, CvCity* pOtherCity);
 	int GetCachedAttackTargetLandDistance(CvCity* pCity, CvCity* pOtherCity);
 	void RefreshDistanceCaches();
+
+	int GetCachedCityNeighborhoodPower(CvCity* pCity);
+	bool GetCachedCityHasDeploymentRoom(CvCity* pCity);
 #endif
 	CvMilitaryTarget FindBestAttackTarget(AIOperationTypes eAIOperationType, PlayerTypes eEnemy, int* piWinningScore = NULL);
 	void CheckApproachFromLandAndSea(CvMilitaryTarget& target, AIOperationTypes eAIOperationType);
@@ -453,6 +471,11 @@ private:
 	CachedTargetsMap m_cachedTargets;
 	CachedDistancesMap m_cachedWaterDistances;
 	CachedDistancesMap m_cachedLandDistances;
+
+	// recomputed each turn, shared by every target search in that turn
+	CachedCitySituationsMap m_cachedCitySituations;
+	int m_iCachedCitySituationsTurn;
+	SCachedCitySituation& GetCachedCitySituation(CvCity* pCity);
 #endif
 
 	// Data recomputed each turn (no need to serialize)
@@ -5412,7 +5412,7 @@ void CvMinorCivAI::DoTurn()
 								continue;
 							}
 							CvNotifications* pNotifications = GET_PLAYER(ePlayer).GetNotifications();
-							if(pNotifications)
+							if(pNotifications && pNotifications->IsRecording())
 							{
 								Localization::String strSummary;
 								Localization::String strNotification;
@@ -6420,7 +6420,7 @@ void CvMinorCivAI::AddNotification(CvString sString, CvString sSummaryString, Pl
 	}
 
 	CvNotifications* pNotifications = GET_PLAYER(ePlayer).GetNotifications();
-	if(pNotifications)
+	if(pNotifications && pNotifications->IsRecording())
 	{
 		pNotifications->Add(NOTIFICATION_MINOR, sString, sSummaryString, iX, iY, GetPlayer()->GetID());
 	}
@@ -6430,7 +6430,7 @@ void CvMinorCivAI::AddNotification(CvString sString, CvString sSummaryString, Pl
 void CvMinorCivAI::AddQuestNotification(CvString sString, CvString sSummaryString, PlayerTypes ePlayer, int iX, int iY, bool bNewQuest)
 {
 	CvNotifications* pNotifications = GET_PLAYER(ePlayer).GetNotifications();
-	if(pNotifications)
+	if(pNotifications && pNotifications->IsRecording())
 	{
 		sString += "[NEWLINE][NEWLINE]";
 		sString += Localization::Lookup("TXT_KEY_MINOR_QUEST_BLOCKING_TT").toUTF8();
@@ -6457,7 +6457,7 @@ void CvMinorCivAI::AddBuyoutNotification(CvString sString, CvString sSummaryStri
 	}
 
 	CvNotifications* pNotifications = GET_PLAYER(ePlayer).GetNotifications();
-	if(pNotifications)
+	if(pNotifications && pNotifications->IsRecording())
 	{
 		pNotifications->Add(NOTIFICATION_MINOR_BUYOUT, sString, sSummaryString, iX, iY, GetPlayer()->GetID());
 	}
@@ -6869,10 +6869,26 @@ void CvMinorCivAI::DoTestStartGlobalQuest()
 		return;
 	}
 
+	// Which majors can be given a quest at all? This doesn't depend on the quest type, so only check once
+	bool abEligiblePlayer[MAX_MAJOR_CIVS];
+	int iNumEligiblePlayers = 0;
+	PlayerTypes ePlayer;
+	for(int iPlayerLoop = 0; iPlayerLoop < MAX_MAJOR_CIVS; iPlayerLoop++)
+	{
+		ePlayer = (PlayerTypes) iPlayerLoop;
+		abEligiblePlayer[iPlayerLoop] = IsQuestEligiblePlayer(ePlayer);
+		if(abEligiblePlayer[iPlayerLoop])
+			iNumEligiblePlayers++;
+	}
+
+	if(iNumEligiblePlayers == 0)
+	{
+		return;
+	}
+
 	// Pick a valid quest
 	FStaticVector<MinorCivQuestTypes, NUM_MINOR_CIV_QUEST_TYPES, true, c_eCiv5GameplayDLL, 0> veValidQuests;
 	MinorCivQuestTypes eQuest;
-	PlayerTypes ePlayer;
 	for(int iQuestLoop = 0; iQuestLoop < NUM_MINOR_CIV_QUEST_TYPES; iQuestLoop++)
 	{
 		eQuest = (MinorCivQuestTypes) iQuestLoop;
@@ -6881,9 +6897,15 @@ void CvMinorCivAI::DoTestStartGlobalQuest()
 			if(IsGlobalQuest(eQuest))
 			{
 				// Are there enough players for this quest to be given out?
+				if(iNumEligiblePlayers < GetMinPlayersNeededForQuest(eQuest))
+					continue;
+
 				int iNumValidPlayers = 0;
 				for(int iPlayerLoop = 0; iPlayerLoop < MAX_MAJOR_CIVS; iPlayerLoop++)
 				{
+					if(!abEligiblePlayer[iPlayerLoop])
+						continue;
+
 					ePlayer = (PlayerTypes) iPlayerLoop;
 					if(IsValidQuestForPlayer(ePlayer, eQuest))
 						iNumValidPlayers++;
@@ -6914,6 +6936,9 @@ void CvMinorCivAI::DoTestStartGlobalQuest()
 	// Give out the quest
 	for(int iPlayerLoop = 0; iPlayerLoop < MAX_MAJOR_CIVS; iPlayerLoop++)
 	{
+		if(!abEligiblePlayer[iPlayerLoop])
+			continue;
+
 		ePlayer = (PlayerTypes) iPlayerLoop;
 		if(IsValidQuestForPlayer(ePlayer, eQuest))
 		{
@@ -6944,6 +6969,12 @@ void CvMinorCivAI::DoTestStartPersonalQuest(PlayerTypes ePlayer)
 		return;
 	}
 
+	// Nothing to hand out if this player can't be given any quest right now
+	if(!IsQuestEligiblePlayer(ePlayer))
+	{
+		return;
+	}
+
 	FStaticVector<MinorCivQuestTypes, NUM_MINOR_CIV_QUEST_TYPES, true, c_eCiv5GameplayDLL, 0> veValidQuests;
 
 	int iCount, iCountLoop;
@@ -6953,7 +6984,7 @@ void CvMinorCivAI::DoTestStartPersonalQuest(PlayerTypes ePlayer)
 	{
 		eQuest = (MinorCivQuestTypes) iQuestLoop;
 
-		if(IsValidQuestForPlayer(ePlayer, eQuest) && IsPersonalQuest(eQuest))
+		if(IsPersonalQuest(eQuest) && IsValidQuestForPlayer(ePlayer, eQuest))
 		{
 			// What is the bias for this player wanting this particular quest? Queue up multiple copies (default is 10)
 			iCount = GetPersonalityQuestBias(eQuest);
@@ -7559,13 +7590,9 @@ bool CvMinorCivAI::IsEnabledQuest(MinorCivQuestTypes eQuest)
 	return true;
 }
 
-/// Is eQuest valid for this minor to give to ePlayer?
-bool CvMinorCivAI::IsValidQuestForPlayer(PlayerTypes ePlayer, MinorCivQuestTypes eQuest)
+/// Can ePlayer be given any quest at all, regardless of its type?
+bool CvMinorCivAI::IsQuestEligiblePlayer(PlayerTypes ePlayer)
 {
-	// The quest type must be enabled
-	if(!IsEnabledQuest(eQuest))
-		return false;
-
 	// Somebody's dead, that's no good
 	if(!GET_PLAYER(ePlayer).isAlive() || !GetPlayer()->isAlive())
 		return false;
@@ -7578,11 +7605,6 @@ bool CvMinorCivAI::IsValidQuestForPlayer(PlayerTypes ePlayer, MinorCivQuestTypes
 			return false;
 		}
 	}
-	//Only one map-specific quest per minor for now. Keeps the tap icons clear.
-	if(PlayerHasTarget(ePlayer, eQuest))
-	{
-		return false;
-	}
 #endif
 
 	// No quests are valid if we are at war
@@ -7593,15 +7615,38 @@ bool CvMinorCivAI::IsValidQuestForPlayer(PlayerTypes ePlayer, MinorCivQuestTypes
 	if(!IsHasMetPlayer(ePlayer))
 		return false;
 
+	// Both players must have a capital
+	if(GetPlayer()->getCapitalCity() == NULL || GET_PLAYER(ePlayer).getCapitalCity() == NULL)
+		return false;
+
+	return true;
+}
+
+/// Is eQuest valid for this minor to give to ePlayer?
+bool CvMinorCivAI::IsValidQuestForPlayer(PlayerTypes ePlayer, MinorCivQuestTypes eQuest)
+{
+	// The quest type must be enabled
+	if(!IsEnabledQuest(eQuest))
+		return false;
+
+	// Checks that don't depend on the quest type (alive, met, at peace, capitals)
+	if(!IsQuestEligiblePlayer(ePlayer))
+		return false;
+
+#if defined(MOD_BALANCE_CORE_MINORS) || defined(MOD_DIPLOMACY_CITYSTATES_QUESTS)
+	//Only one map-specific quest per minor for now. Keeps the tap icons clear.
+	if(PlayerHasTarget(ePlayer, eQuest))
+	{
+		return false;
+	}
+#endif
+
 	// This player cannot already have an active quest of the same type
 	if(IsActiveQuestForPlayer(ePlayer, eQuest))
 		return false;
 
-	// Both players must have a capital
+	// Both capitals are known to exist at this point
 	CvCity* pMinorsCapital = GetPlayer()->getCapitalCity();
-	CvCity* pMajorsCapital = GET_PLAYER(ePlayer).getCapitalCity();
-	if(pMinorsCapital == NULL || pMajorsCapital == NULL)
-		return false;
 
 	// BUILD A ROUTE
 	if(eQuest == MINOR_CIV_QUEST_ROUTE)
@@ -9185,7 +9230,7 @@ void CvMinorCivAI::DoTestSeedQuestCountdownForPlayer(PlayerTypes ePlayer, bool b
 	// Quests are now available for the first time?
 	if(GC.getGame().getElapsedGameTurns() == GetFirstPossibleTurnForPersonalQuests())
 	{
-		iNumTurns += GC.getGame().getSmallFakeRandNum(GC.getMINOR_CIV_PERSONAL_QUEST_FIRST_POSSIBLE_TURN_RAND(), GC.getGame().getElapsedGameTurns());
+		iNumTurns += GC.getGame().getKeyedRandNum(GC.getMINOR_CIV_PERSONAL_QUEST_FIRST_POSSIBLE_TURN_RAND(), RAND_STREAM_MINOR_CIVS, GetPlayer()->GetID(), ePlayer);
 	}
 	else
 	{
@@ -9197,7 +9242,7 @@ void CvMinorCivAI::DoTestSeedQuestCountdownForPlayer(PlayerTypes ePlayer, bool b
 			iRand *= /*200*/ GC.getMINOR_CIV_PERSONAL_QUEST_RAND_TURNS_BETWEEN_HOSTILE_MULTIPLIER();
 			iRand /= 100;
 		}
-		iNumTurns += GC.getGame().getSmallFakeRandNum((iRand / 3), GC.getGame().getElapsedGameTurns()) * 4;
+		iNumTurns += GC.getGame().getKeyedRandNum((iRand / 3), RAND_STREAM_MINOR_CIVS, GetPlayer()->GetID(), ePlayer) * 4;
 	}
 
 	// Modify for Game Speed
@@ -12532,6 +12577,15 @@ void CvMinorCivAI::DoFriendshipChangeEffects(PlayerTypes ePlayer, int iOldFriend
 		else
 			SetAlly(NO_PLAYER);	// We KNOW no one else can be higher, so set the Ally to NO_PLAYER
 	}
+
+	//open borders follow the friends (or allies) status, generic paths only change when that flips
+#if defined(MOD_WWII_TERRITORY)
+	if(GetAlly() != eOldAlly)
+#else
+	if(bFriends && !IsPlayerHasOpenBordersAutomatically(ePlayer))
+#endif
+		GC.GetStepFinder().ClearPathCache();
+
 	if (ePlayer != NO_PLAYER)
 	{
 		GET_PLAYER(ePlayer).RefreshCSAlliesFriends();
@@ -13141,7 +13195,7 @@ void CvMinorCivAI::DoLiberationByMajor(PlayerTypes eLiberator, TeamTypes eConque
 
 					// Notification for other players
 					CvNotifications* pNotifications = GET_PLAYER(ePlayer).GetNotifications();
-					if(pNotifications)
+					if(pNotifications && pNotifications->IsRecording())
 					{
 						pNotifications->Add(NOTIFICATION_DIPLOMACY_DECLARATION, strMessage.toUTF8(), strSummary.toUTF8(), -1, -1, -1);
 					}
@@ -16829,7 +16883,7 @@ void CvMinorCivAI::DoElection()
 			if(ePlayer == eElectionWinner)
 			{
 				CvNotifications* pNotifications = GET_PLAYER(ePlayer).GetNotifications();
-				if(pNotifications)
+				if(pNotifications && pNotifications->IsRecording())
 				{
 					Localization::String strSummary = Localization::Lookup("TXT_KEY_NOTIFICATION_SPY_RIG_ELECTION_SUCCESS_S");
 					strSummary << pCapital->getNameKey();
@@ -16865,7 +16919,7 @@ void CvMinorCivAI::DoElection()
 				if(apSpy[ui] != NULL)
 				{
 					CvNotifications* pNotifications = GET_PLAYER(ePlayer).GetNotifications();
-					if(pNotifications)
+					if(pNotifications && pNotifications->IsRecording())
 					{
 						Localization::String strSummary = Localization::Lookup("TXT_KEY_NOTIFICATION_SPY_RIG_ELECTION_FAILURE_S");
 						strSummary << pCapital->getNameKey();
@@ -16885,7 +16939,7 @@ void CvMinorCivAI::DoElection()
 				{
 					// no spy in the city, so just give them an alert that scenanigans are going on
 					CvNotifications* pNotifications = GET_PLAYER(ePlayer).GetNotifications();
-					if(pNotifications)
+					if(pNotifications && pNotifications->IsRecording())
 					{
 						Localization::String strSummary = Localization::Lookup("TXT_KEY_NOTIFICATION_SPY_RIG_ELECTION_ALERT_S");
 						strSummary << pCapital->getNameKey();
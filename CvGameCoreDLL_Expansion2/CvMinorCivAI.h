@@ -369,6 +369,7 @@ public:
 	bool PlayerHasTarget(PlayerTypes ePlayer, MinorCivQuestTypes eQuest);
 #endif
 	bool IsEnabledQuest(MinorCivQuestTypes eQuest);
+	bool IsQuestEligiblePlayer(PlayerTypes ePlayer);
 	bool IsValidQuestForPlayer(PlayerTypes ePlayer, MinorCivQuestTypes eQuest);
 	bool IsValidQuestCopyForPlayer(PlayerTypes ePlayer, CvMinorCivQuest* pQuest);
 	bool IsGlobalQuest(MinorCivQuestTypes eQuest) const;
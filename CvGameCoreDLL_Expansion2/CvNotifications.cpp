@@ -254,6 +254,9 @@ void CvNotifications::Init(PlayerTypes ePlayer)
 	}
 	m_iNotificationsBeginIndex = 0;
 	m_iNotificationsEndIndex = 0;
+
+	m_aiNumNotificationsOfType.clear();
+	m_iNumActiveBlockingNotifications = 0;
 }
 
 /// Uninit
@@ -265,6 +268,9 @@ void CvNotifications::Uninit(void)
 
 	m_iNotificationsBeginIndex = -1;
 	m_iNotificationsEndIndex = -1;
+
+	m_aiNumNotificationsOfType.clear();
+	m_iNumActiveBlockingNotifications = 0;
 }
 
 /// Serialization read
@@ -291,6 +297,8 @@ void CvNotifications::Read(FDataStream& kStream)
 				m_aNotifications[ui].m_eNotificationType = (NotificationTypes)V1_IndexToHash[iIndex];
 		}
 	}
+
+	RebuildIndexes();
 }
 
 /// Serialization write
@@ -400,16 +408,11 @@ int CvNotifications::AddByName(const char* pszNotificationName, const char* strM
 /// Adds a new notification to the list
 int CvNotifications::Add(NotificationTypes eNotificationType, const char* strMessage, const char* strSummary, int iX, int iY, int iGameDataIndex, int iExtraGameData)
 {
-	// if the player is not human, do not record
-	if(!GET_PLAYER(m_ePlayer).isHuman())
+	if(!IsRecording())
 	{
 		return -1;
 	}
 
-	// If we're in debug mode, don't do anything
-	if(GC.getGame().isDebugMode())
-		return -1;
-
 	Notification newNotification;
 	newNotification.Clear();
 	newNotification.m_ePlayerID = m_ePlayer;
@@ -443,6 +446,7 @@ int CvNotifications::Add(NotificationTypes eNotificationType, const char* strMes
 	}
 
 	m_aNotifications[m_iNotificationsEndIndex] = newNotification;
+	AddToIndexes(newNotification);
 
 	if(GC.getGame().isFinalInitialized())
 	{
@@ -492,6 +496,22 @@ int CvNotifications::Add(NotificationTypes eNotificationType, const char* strMes
 	return newNotification.m_iLookupIndex;
 }
 
+//	---------------------------------------------------------------------------
+bool CvNotifications::IsRecording() const
+{
+	// if the player is not human, do not record
+	if(!GET_PLAYER(m_ePlayer).isHuman())
+	{
+		return false;
+	}
+
+	// If we're in debug mode, don't do anything
+	if(GC.getGame().isDebugMode())
+		return false;
+
+	return true;
+}
+
 //	---------------------------------------------------------------------------
 void CvNotifications::Activate(int iLookupIndex)
 {
@@ -519,6 +539,10 @@ void CvNotifications::Dismiss(int iLookupIndex, bool bUserInvoked)
 	{
 		if(m_aNotifications[iIndex].m_iLookupIndex == iLookupIndex)
 		{
+			if(!m_aNotifications[iIndex].m_bDismissed && GetEndTurnBlockingType(m_aNotifications[iIndex].m_eNotificationType) != NO_ENDTURN_BLOCKING_TYPE)
+			{
+				m_iNumActiveBlockingNotifications--;
+			}
 			m_aNotifications[iIndex].m_bDismissed = true;
 			GC.GetEngineUserInterface()->RemoveNotification(m_aNotifications[iIndex].m_iLookupIndex, m_ePlayer);
 
@@ -644,163 +668,37 @@ bool CvNotifications::GetEndTurnBlockedType(EndTurnBlockingTypes& eBlockingType,
 {
 	eBlockingType = NO_ENDTURN_BLOCKING_TYPE;
 	iNotificationIndex = -1;
+
+	// the UI polls this constantly, and most of the time nothing is blocking
+	if(m_iNumActiveBlockingNotifications <= 0)
+	{
+		return false;
+	}
 	
 	int iIndex = m_iNotificationsBeginIndex;
 	while(iIndex != m_iNotificationsEndIndex)
 	{
 		if(!m_aNotifications[iIndex].m_bDismissed)
 		{
-			switch(m_aNotifications[iIndex].m_eNotificationType)
-			{
-			case NOTIFICATION_CITY_RANGE_ATTACK:
-			{
-				bool automaticallyEndTurns = GC.getGame().isGameMultiPlayer() ? GC.GetEngineUserInterface()->IsMPAutoEndTurnEnabled() : GC.GetEngineUserInterface()->IsSPAutoEndTurnEnabled();
-				if(automaticallyEndTurns)
-				{//City range attacks only block turns if the player is using auto end turn.
-					eBlockingType = ENDTURN_BLOCKING_CITY_RANGE_ATTACK;
-					iNotificationIndex = m_aNotifications[iIndex].m_iLookupIndex;
-					return true;
-				}
-				break;
-			}
-
-			case NOTIFICATION_DIPLO_VOTE:
-				eBlockingType = ENDTURN_BLOCKING_DIPLO_VOTE;
-				iNotificationIndex = m_aNotifications[iIndex].m_iLookupIndex;
-				return true;
-				break;
-
-			case NOTIFICATION_PRODUCTION:
-				eBlockingType = ENDTURN_BLOCKING_PRODUCTION;
-				iNotificationIndex = m_aNotifications[iIndex].m_iLookupIndex;
-				return true;
-				break;
+			EndTurnBlockingTypes eType = GetEndTurnBlockingType(m_aNotifications[iIndex].m_eNotificationType);
+			bool bBlocks = (eType != NO_ENDTURN_BLOCKING_TYPE);
 
+			if(eType == ENDTURN_BLOCKING_CITY_RANGE_ATTACK)
+			{//City range attacks only block turns if the player is using auto end turn.
+				bBlocks = GC.getGame().isGameMultiPlayer() ? GC.GetEngineUserInterface()->IsMPAutoEndTurnEnabled() : GC.GetEngineUserInterface()->IsSPAutoEndTurnEnabled();
+			}
 #if defined(MOD_UI_CITY_EXPANSION)
-			case NOTIFICATION_CITY_TILE:
-				if (MOD_UI_CITY_EXPANSION) 
-				{
-					eBlockingType = ENDTURN_BLOCKING_CITY_TILE;
-					iNotificationIndex = m_aNotifications[iIndex].m_iLookupIndex;
-					return true;
-				}
-				break;
+			else if(eType == ENDTURN_BLOCKING_CITY_TILE)
+			{
+				bBlocks = MOD_UI_CITY_EXPANSION;
+			}
 #endif
 
-			case NOTIFICATION_POLICY:
-				eBlockingType = ENDTURN_BLOCKING_POLICY;
-				iNotificationIndex = m_aNotifications[iIndex].m_iLookupIndex;
-				return true;
-				break;
-
-			case NOTIFICATION_FREE_POLICY:
-				eBlockingType = ENDTURN_BLOCKING_FREE_POLICY;
-				iNotificationIndex = m_aNotifications[iIndex].m_iLookupIndex;
-				return true;
-				break;
-
-			case NOTIFICATION_TECH:
-				eBlockingType = ENDTURN_BLOCKING_RESEARCH;
-				iNotificationIndex = m_aNotifications[iIndex].m_iLookupIndex;
-				return true;
-				break;
-
-			case NOTIFICATION_FREE_TECH:
-				eBlockingType = ENDTURN_BLOCKING_FREE_TECH;
-				iNotificationIndex = m_aNotifications[iIndex].m_iLookupIndex;
-				return true;
-				break;
-
-			case NOTIFICATION_FREE_GREAT_PERSON:
-				eBlockingType = ENDTURN_BLOCKING_FREE_ITEMS;
-				iNotificationIndex = m_aNotifications[iIndex].m_iLookupIndex;
-				return true;
-				break;
-
-			case NOTIFICATION_FOUND_PANTHEON:
-				eBlockingType = ENDTURN_BLOCKING_FOUND_PANTHEON;
-				iNotificationIndex = m_aNotifications[iIndex].m_iLookupIndex;
-				return true;
-				break;
-
-			case NOTIFICATION_FOUND_RELIGION:
-				eBlockingType = ENDTURN_BLOCKING_FOUND_RELIGION;
-				iNotificationIndex = m_aNotifications[iIndex].m_iLookupIndex;
-				return true;
-				break;
-
-			case NOTIFICATION_ENHANCE_RELIGION:
-				eBlockingType = ENDTURN_BLOCKING_ENHANCE_RELIGION;
-				iNotificationIndex = m_aNotifications[iIndex].m_iLookupIndex;
-				return true;
-				break;
-
-			case NOTIFICATION_SPY_STOLE_TECH:
-				eBlockingType = ENDTURN_BLOCKING_STEAL_TECH;
-				iNotificationIndex = m_aNotifications[iIndex].m_iLookupIndex;
-				return true;
-				break;
-
-			case NOTIFICATION_MAYA_LONG_COUNT:
-				eBlockingType = ENDTURN_BLOCKING_MAYA_LONG_COUNT;
-				iNotificationIndex = m_aNotifications[iIndex].m_iLookupIndex;
-				return true;
-				break;
-
-			case NOTIFICATION_FAITH_GREAT_PERSON:
-				eBlockingType = ENDTURN_BLOCKING_FAITH_GREAT_PERSON;
-				iNotificationIndex = m_aNotifications[iIndex].m_iLookupIndex;
-				return true;
-				break;
-
-			case NOTIFICATION_ADD_REFORMATION_BELIEF:
-				eBlockingType = ENDTURN_BLOCKING_ADD_REFORMATION_BELIEF;
-				iNotificationIndex = m_aNotifications[iIndex].m_iLookupIndex;
-				return true;
-				break;
-
-			case NOTIFICATION_LEAGUE_CALL_FOR_PROPOSALS:
-				eBlockingType = ENDTURN_BLOCKING_LEAGUE_CALL_FOR_PROPOSALS;
-				iNotificationIndex = m_aNotifications[iIndex].m_iLookupIndex;
-				return true;
-				break;
-
-			case NOTIFICATION_CHOOSE_ARCHAEOLOGY:
-				eBlockingType = ENDTURN_BLOCKING_CHOOSE_ARCHAEOLOGY;
-				iNotificationIndex = m_aNotifications[iIndex].m_iLookupIndex;
-				return true;
-				break;
-
-			case NOTIFICATION_LEAGUE_CALL_FOR_VOTES:
-				eBlockingType = ENDTURN_BLOCKING_LEAGUE_CALL_FOR_VOTES;
-				iNotificationIndex = m_aNotifications[iIndex].m_iLookupIndex;
-				return true;
-				break;
-
-			case NOTIFICATION_CHOOSE_IDEOLOGY:
-				eBlockingType = ENDTURN_BLOCKING_CHOOSE_IDEOLOGY;
-				iNotificationIndex = m_aNotifications[iIndex].m_iLookupIndex;
-				return true;
-				break;
-
-#if defined(MOD_BALANCE_CORE)
-			case NOTIFICATION_PLAYER_DEAL_RECEIVED:
-				eBlockingType = ENDTURN_BLOCKING_PENDING_DEAL;
-				iNotificationIndex = m_aNotifications[iIndex].m_iLookupIndex;
-				return true;
-				break;
-
-			case 826076831:
-			case 419811917:
-				eBlockingType = ENDTURN_BLOCKING_EVENT_CHOICE;
+			if(bBlocks)
+			{
+				eBlockingType = eType;
 				iNotificationIndex = m_aNotifications[iIndex].m_iLookupIndex;
 				return true;
-				break;
-#endif
-
-			default:
-				// these notifications don't block, so don't return a blocking type
-				break;
 			}
 		}
 
@@ -1270,6 +1168,13 @@ void CvNotifications::Activate(Notification& notification)
 //	---------------------------------------------------------------------------
 bool CvNotifications::IsNotificationRedundant(Notification& notification)
 {
+	// every check below looks for another entry of the same type
+	std::map<NotificationTypes, int>::const_iterator it = m_aiNumNotificationsOfType.find(notification.m_eNotificationType);
+	if(it == m_aiNumNotificationsOfType.end() || it->second <= 0)
+	{
+		return false;
+	}
+
 	switch(notification.m_eNotificationType)
 	{
 	case NOTIFICATION_TECH:
@@ -2277,6 +2182,7 @@ void CvNotifications::RemoveOldestNotification()
 	{
 		Dismiss(m_aNotifications[m_iNotificationsBeginIndex].m_iLookupIndex, /*bUserInvoked*/ false);
 	}
+	RemoveFromIndexes(m_aNotifications[m_iNotificationsBeginIndex]);
 	m_aNotifications[m_iNotificationsBeginIndex].Clear();
 	IncrementBeginIndex();
 }
@@ -2299,6 +2205,117 @@ void CvNotifications::IncrementEndIndex()
 	}
 }
 
+//	---------------------------------------------------------------------------
+// static
+EndTurnBlockingTypes CvNotifications::GetEndTurnBlockingType(NotificationTypes eNotificationType)
+{
+	switch(eNotificationType)
+	{
+	case NOTIFICATION_CITY_RANGE_ATTACK:
+		return ENDTURN_BLOCKING_CITY_RANGE_ATTACK;
+	case NOTIFICATION_DIPLO_VOTE:
+		return ENDTURN_BLOCKING_DIPLO_VOTE;
+	case NOTIFICATION_PRODUCTION:
+		return ENDTURN_BLOCKING_PRODUCTION;
+#if defined(MOD_UI_CITY_EXPANSION)
+	case NOTIFICATION_CITY_TILE:
+		return ENDTURN_BLOCKING_CITY_TILE;
+#endif
+	case NOTIFICATION_POLICY:
+		return ENDTURN_BLOCKING_POLICY;
+	case NOTIFICATION_FREE_POLICY:
+		return ENDTURN_BLOCKING_FREE_POLICY;
+	case NOTIFICATION_TECH:
+		return ENDTURN_BLOCKING_RESEARCH;
+	case NOTIFICATION_FREE_TECH:
+		return ENDTURN_BLOCKING_FREE_TECH;
+	case NOTIFICATION_FREE_GREAT_PERSON:
+		return ENDTURN_BLOCKING_FREE_ITEMS;
+	case NOTIFICATION_FOUND_PANTHEON:
+		return ENDTURN_BLOCKING_FOUND_PANTHEON;
+	case NOTIFICATION_FOUND_RELIGION:
+		return ENDTURN_BLOCKING_FOUND_RELIGION;
+	case NOTIFICATION_ENHANCE_RELIGION:
+		return ENDTURN_BLOCKING_ENHANCE_RELIGION;
+	case NOTIFICATION_SPY_STOLE_TECH:
+		return ENDTURN_BLOCKING_STEAL_TECH;
+	case NOTIFICATION_MAYA_LONG_COUNT:
+		return ENDTURN_BLOCKING_MAYA_LONG_COUNT;
+	case NOTIFICATION_FAITH_GREAT_PERSON:
+		return ENDTURN_BLOCKING_FAITH_GREAT_PERSON;
+	case NOTIFICATION_ADD_REFORMATION_BELIEF:
+		return ENDTURN_BLOCKING_ADD_REFORMATION_BELIEF;
+	case NOTIFICATION_LEAGUE_CALL_FOR_PROPOSALS:
+		return ENDTURN_BLOCKING_LEAGUE_CALL_FOR_PROPOSALS;
+	case NOTIFICATION_CHOOSE_ARCHAEOLOGY:
+		return ENDTURN_BLOCKING_CHOOSE_ARCHAEOLOGY;
+	case NOTIFICATION_LEAGUE_CALL_FOR_VOTES:
+		return ENDTURN_BLOCKING_LEAGUE_CALL_FOR_VOTES;
+	case NOTIFICATION_CHOOSE_IDEOLOGY:
+		return ENDTURN_BLOCKING_CHOOSE_IDEOLOGY;
+#if defined(MOD_BALANCE_CORE)
+	case NOTIFICATION_PLAYER_DEAL_RECEIVED:
+		return ENDTURN_BLOCKING_PENDING_DEAL;
+	case 826076831:
+	case 419811917:
+		return ENDTURN_BLOCKING_EVENT_CHOICE;
+#endif
+	default:
+		// these notifications don't block
+		break;
+	}
+
+	return NO_ENDTURN_BLOCKING_TYPE;
+}
+
+//	---------------------------------------------------------------------------
+void CvNotifications::AddToIndexes(const Notification& notification)
+{
+	m_aiNumNotificationsOfType[notification.m_eNotificationType]++;
+
+	if(!notification.m_bDismissed && GetEndTurnBlockingType(notification.m_eNotificationType) != NO_ENDTURN_BLOCKING_TYPE)
+	{
+		m_iNumActiveBlockingNotifications++;
+	}
+}
+
+//	---------------------------------------------------------------------------
+void CvNotifications::RemoveFromIndexes(const Notification& notification)
+{
+	std::map<NotificationTypes, int>::iterator it = m_aiNumNotificationsOfType.find(notification.m_eNotificationType);
+	if(it != m_aiNumNotificationsOfType.end())
+	{
+		if(--it->second <= 0)
+		{
+			m_aiNumNotificationsOfType.erase(it);
+		}
+	}
+
+	if(!notification.m_bDismissed && GetEndTurnBlockingType(notification.m_eNotificationType) != NO_ENDTURN_BLOCKING_TYPE)
+	{
+		m_iNumActiveBlockingNotifications--;
+	}
+}
+
+//	---------------------------------------------------------------------------
+void CvNotifications::RebuildIndexes()
+{
+	m_aiNumNotificationsOfType.clear();
+	m_iNumActiveBlockingNotifications = 0;
+
+	int iIndex = m_iNotificationsBeginIndex;
+	while(iIndex != m_iNotificationsEndIndex)
+	{
+		AddToIndexes(m_aNotifications[iIndex]);
+
+		iIndex++;
+		if(iIndex >= (int)m_aNotifications.size())
+		{
+			iIndex = 0;
+		}
+	}
+}
+
 //	---------------------------------------------------------------------------
 // static
 void CvNotifications::AddToPlayer(PlayerTypes ePlayer, NotificationTypes eNotificationType, const char* strMessage, const char* strSummary, int iX/*=-1*/, int iY/*=-1*/, int iGameDataIndex/*=-1*/, int iExtraGameData/*=-1*/)
@@ -48,6 +48,7 @@ public:
 
 	int  AddByName(const char* szNotificationName, const char* strMessage, const char* strSummary, int iX, int iY, int iGameDataIndex, int iExtraGameData=-1);
 	int  Add(NotificationTypes eNotificationType, const char* strMessage, const char* strSummary, int iX, int iY, int iGameDataIndex, int iExtraGameData=-1);
+	bool IsRecording() const;  // would Add() keep a notification right now? check before building message strings
 	void Activate(int iLookupIndex);
 	void Dismiss(int iLookupIndex, bool bUserInvoked);
 	bool MayUserDismiss(int iLookupIndex);  // may the user dismiss this notification using the user interface without completing its action
@@ -99,6 +100,11 @@ protected:
 	void IncrementBeginIndex();
 	void IncrementEndIndex();
 
+	static EndTurnBlockingTypes GetEndTurnBlockingType(NotificationTypes eNotificationType);  // what this type blocks while active, ignoring UI settings
+	void AddToIndexes(const Notification& notification);
+	void RemoveFromIndexes(const Notification& notification);
+	void RebuildIndexes();
+
 	PlayerTypes m_ePlayer;
 
 	std::vector<Notification> m_aNotifications;
@@ -106,6 +112,10 @@ protected:
 	int m_iNotificationsEndIndex;
 
 	int m_iCurrentLookupIndex;
+
+	// Indexes over the ring buffer, kept in step by Add/Dismiss/RemoveOldestNotification and rebuilt on load
+	std::map<NotificationTypes, int> m_aiNumNotificationsOfType;  // entries in the buffer, dismissed or not
+	int m_iNumActiveBlockingNotifications;  // undismissed entries whose type can block the end of turn
 };
 
 FDataStream& operator>>(FDataStream&, CvNotifications::Notification&);
@@ -74,8 +74,49 @@
 // CvPlayer Version History
 // Version 1 
 //	 * CvPlayer save version reset for expansion pack 2.
+// Version 17
+//	 * Player subsystems, cities, units, armies and operations are stored as checksummed chunks.
+// Version 18
+//	 * Replay data values are stored as one dense vector per data set, indexed by turn.
 //------------------------------------------------------------------------------
-const int g_CurrentCvPlayerVersion = 16;
+const int g_CurrentCvPlayerVersion = 18;
+const int g_FirstChunkedCvPlayerVersion = 17;
+const int g_MaxCvPlayerChunkSize = 64 * 1024 * 1024;
+const int g_FirstDenseReplayDataCvPlayerVersion = 18;
+
+//names of CvPlayer::BuiltInReplayDataSetTypes, in the same order
+static const char* s_aszBuiltInReplayDataSetNames[CvPlayer::NUM_BUILTIN_REPLAYDATASETS] =
+{
+	"REPLAYDATASET_SCORE",
+	"REPLAYDATASET_PRODUCTIONPERTURN",
+	"REPLAYDATASET_TOTALGOLD",
+	"REPLAYDATASET_GOLDPERTURN",
+	"REPLAYDATASET_CITYCOUNT",
+	"REPLAYDATASET_TECHSKNOWN",
+	"REPLAYDATASET_SCIENCEPERTURN",
+	"REPLAYDATASET_TOTALCULTURE",
+	"REPLAYDATASET_CULTUREPERTURN",
+	"REPLAYDATASET_TOURISMPERTURN",
+	"REPLAYDATASET_EXCESSHAPINESS",
+	"REPLAYDATASET_HAPPINESS",
+	"REPLAYDATASET_UNHAPPINESS",
+	"REPLAYDATASET_GOLDENAGETURNS",
+	"REPLAYDATASET_POPULATION",
+	"REPLAYDATASET_FOODPERTURN",
+	"REPLAYDATASET_TOTALLAND",
+	"REPLAYDATASET_GPTCITYCONNECTIONS",
+	"REPLAYDATASET_GPTINTERNATIONALTRADE",
+	"REPLAYDATASET_GPTDEALS",
+	"REPLAYDATASET_UNITMAINTENANCE",
+	"REPLAYDATASET_BUILDINGMAINTENANCE",
+	"REPLAYDATASET_IMPROVEMENTMAINTENANCE",
+	"REPLAYDATASET_NUMBEROFPOLICIES",
+	"REPLAYDATASET_NUMBEROFWORKERS",
+	"REPLAYDATASET_IMPROVEDTILES",
+	"REPLAYDATASET_WORKEDTILES",
+	"REPLAYDATASET_MILITARYMIGHT",
+};
+static const unsigned int NO_REPLAYDATASET = 0xFFFFFFFF;
 
 //Simply empty check utility.
 bool isEmpty(const char* szString)
@@ -1257,6 +1298,10 @@ void CvPlayer::uninit()
 	m_aiPlots.clear();
 	m_bfEverConqueredBy.ClearAll();
 
+	m_aeProductionUnitCandidates.clear();
+	m_aeProductionBuildingCandidates.clear();
+	m_bProductionCandidatesValid = false;
+
 	FAutoArchive& archive = getSyncArchive();
 	archive.clearDelta();
 
@@ -1280,6 +1325,8 @@ void CvPlayer::uninit()
 #if defined(MOD_BALANCE_CORE_HAPPINESS)
 	m_iUnhappiness = 0;
 	m_iHappinessTotal = 0;
+	m_iHappinessUpdateBatchDepth = 0;
+	m_bHappinessUpdatePending = false;
 	m_iChangePovertyUnhappinessGlobal = 0;
 	m_iChangeDefenseUnhappinessGlobal = 0;
 	m_iChangeUnculturedUnhappinessGlobal = 0;
@@ -1456,6 +1503,7 @@ void CvPlayer::uninit()
 	m_iPolicyCostBuildingModifier = 0;
 	m_iPolicyCostMinorCivModifier = 0;
 	m_iInfluenceSpreadModifier = 0;
+	m_iNumInfluenceNullifyingBuildings = 0;
 	m_iExtraVotesPerDiplomat = 0;
 	m_iNumNukeUnits = 0;
 	m_iNumOutsideUnits = 0;
@@ -1876,6 +1924,9 @@ void CvPlayer::reset(PlayerTypes eID, bool bConstructorCall)
 
 	m_aOptions.clear();
 
+	for(int i = 0; i < NUM_BUILTIN_REPLAYDATASETS; i++)
+		m_auiBuiltInReplayDataSets[i] = NO_REPLAYDATASET;
+
 	m_strReligionKey = "";
 	m_strScriptData = "";
 	m_strEmbarkedGraphicOverride = "";
@@ -2720,7 +2771,7 @@ CvPlot* CvPlayer::addFreeUnit(UnitTypes eUnit, UnitAITypes eUnitAI)
 					{
 						pLoopCity->ChangeWeLoveTheKingDayCounter(iWLTKD);
 						CvNotifications* pNotifications = GetNotifications();
-						if (pNotifications)
+						if (pNotifications && pNotifications->IsRecording())
 						{
 							Localization::String strText = Localization::Lookup("TXT_KEY_NOTIFICATION_CITY_WLTKD_UNIT");
 							strText << pNewUnit->getNameKey() << pLoopCity->getNameKey();
@@ -2747,7 +2798,7 @@ CvPlot* CvPlayer::addFreeUnit(UnitTypes eUnit, UnitAITypes eUnitAI)
 				getCapitalCity()->ChangeJONSCultureStored(iValue);
 			}
 			CvNotifications* pNotifications = GetNotifications();
-			if (pNotifications)
+			if (pNotifications && pNotifications->IsRecording())
 			{
 				Localization::String strText = Localization::Lookup("TXT_KEY_NOTIFICATION_CULTURE_UNIT");
 				strText << pNewUnit->getNameKey();
@@ -6670,7 +6721,7 @@ void CvPlayer::DoStartEvent(EventTypes eChosenEvent)
 				if(isHuman())
 				{
 					CvNotifications* pNotifications = GetNotifications();
-					if(pNotifications)
+					if(pNotifications && pNotifications->IsRecording())
 					{
 						CvString strBuffer = GetLocalizedText("TXT_KEY_CHOOSE_EVENT_CHOICE");
 						CvString strSummary = GetLocalizedText("TXT_KEY_CHOOSE_EVENT_CHOICE_TT");
@@ -10747,7 +10798,7 @@ void CvPlayer::doTurn()
 		{
 			Localization::String strInstantYield = Localization::Lookup(getInstantYieldText(eInstantYield));
 			CvNotifications* pNotifications = GetNotifications();
-			if(pNotifications)
+			if(pNotifications && pNotifications->IsRecording())
 			{
 				Localization::String strSummary = Localization::Lookup("TXT_KEY_NOTIFICATION_SUMMARY_INSTANT_YIELD_EMPIRE");
 				pNotifications->Add((NotificationTypes)FString::Hash("NOTIFICATION_INSTANT_YIELD"), strInstantYield.toUTF8(), strSummary.toUTF8(), -1, -1, GetID());
@@ -10912,7 +10963,7 @@ void CvPlayer::doTurnPostDiplomacy()
 			if(getNextPolicyCost() <= getJONSCulture() && GetPlayerPolicies()->GetNumPoliciesCanBeAdopted() > 0)
 			{
 				CvNotifications* pNotifications = GetNotifications();
-				if(pNotifications)
+				if(pNotifications && pNotifications->IsRecording())
 				{
 					CvString strBuffer;
 
@@ -10937,7 +10988,7 @@ void CvPlayer::doTurnPostDiplomacy()
 			}
 #endif
 			CvNotifications* pNotifications = GetNotifications();
-			if(pNotifications)
+			if(pNotifications && pNotifications->IsRecording())
 			{
 				CvString strBuffer;
 #if defined(MOD_CONFIG_GAME_IN_XML)
@@ -11551,7 +11602,7 @@ void CvPlayer::chooseTech(int iDiscover, const char* strText, TechTypes iTechJus
 	if(iDiscover > 0)
 	{
 		CvNotifications* pNotifications = GetNotifications();
-		if(pNotifications)
+		if(pNotifications && pNotifications->IsRecording())
 		{
 			pNotifications->Add(NOTIFICATION_FREE_TECH, strText, strText, -1, -1, iDiscover, iTechJustDiscovered);
 		}
@@ -11561,7 +11612,7 @@ void CvPlayer::chooseTech(int iDiscover, const char* strText, TechTypes iTechJus
 		CvString strBuffer = GetLocalizedText("TXT_KEY_NOTIFICATION_NEW_RESEARCH");
 		CvString strSummary = GetLocalizedText("TXT_KEY_NOTIFICATION_SUMMARY_NEW_RESEARCH");
 		CvNotifications* pNotifications = GetNotifications();
-		if(pNotifications)
+		if(pNotifications && pNotifications->IsRecording())
 		{
 			pNotifications->Add(NOTIFICATION_TECH, strBuffer, strSummary, -1, -1, iDiscover, iTechJustDiscovered);
 		}
@@ -11569,7 +11620,7 @@ void CvPlayer::chooseTech(int iDiscover, const char* strText, TechTypes iTechJus
 	else
 	{
 		CvNotifications* pNotifications = GetNotifications();
-		if(pNotifications)
+		if(pNotifications && pNotifications->IsRecording())
 		{
 			pNotifications->Add(NOTIFICATION_TECH, strText, strText, -1, -1, iDiscover, iTechJustDiscovered);
 		}
@@ -13706,7 +13757,7 @@ void CvPlayer::doGoody(CvPlot* pPlot, CvUnit* pUnit)
 				else
 				{
 #if defined(MOD_CORE_REDUCE_RANDOMNESS)
-					int iRand = GC.getGame().getSmallFakeRandNum(avValidGoodies.size(),*pPlot);
+					int iRand = GC.getGame().getKeyedRandNum(avValidGoodies.size(), RAND_STREAM_GAME, GetID(), pPlot->GetPlotIndex());
 #else
 					int iRand = GC.getGame().getJonRandNum(avValidGoodies.size(), "Picking a Goody result");
 #endif
@@ -13875,7 +13926,7 @@ void CvPlayer::found(int iX, int iY)
 				{
 					//If the player is human then a net message will be received which will pick the pantheon.
 					CvNotifications* pNotifications = GetNotifications();
-					if(pNotifications)
+					if(pNotifications && pNotifications->IsRecording())
 					{
 						CvString strBuffer = GetLocalizedText("TXT_KEY_NOTIFICATION_ENOUGH_FAITH_FOR_PANTHEON");
 
@@ -14585,6 +14636,83 @@ bool CvPlayer::canBarbariansTrain(UnitTypes eUnit, bool bIgnoreUniqueUnitStatus,
 	return true;
 }
 #endif
+//	--------------------------------------------------------------------------------
+/// Units this player could ever train at normal cost - civilization overrides, missing production cost etc. are filtered out once
+const std::vector<UnitTypes>& CvPlayer::GetProductionUnitCandidates()
+{
+	if(!m_bProductionCandidatesValid)
+		UpdateProductionCandidates();
+
+	return m_aeProductionUnitCandidates;
+}
+
+//	--------------------------------------------------------------------------------
+/// Buildings this player could ever construct at normal cost
+const std::vector<BuildingTypes>& CvPlayer::GetProductionBuildingCandidates()
+{
+	if(!m_bProductionCandidatesValid)
+		UpdateProductionCandidates();
+
+	return m_aeProductionBuildingCandidates;
+}
+
+//	--------------------------------------------------------------------------------
+void CvPlayer::UpdateProductionCandidates()
+{
+	m_aeProductionUnitCandidates.clear();
+	m_aeProductionBuildingCandidates.clear();
+
+	const CvCivilizationInfo& kCivInfo = getCivilizationInfo();
+
+	for(int iI = 0; iI < GC.getNumUnitInfos(); iI++)
+	{
+		const UnitTypes eUnit = (UnitTypes)iI;
+		CvUnitEntry* pkUnitInfo = GC.getUnitInfo(eUnit);
+		if(pkUnitInfo == NULL)
+			continue;
+
+		const UnitClassTypes eUnitClass = (UnitClassTypes)pkUnitInfo->GetUnitClassType();
+		if(eUnitClass == NO_UNITCLASS || GC.getUnitClassInfo(eUnitClass) == NULL)
+			continue;
+
+		// these mirror the early outs in canTrain which can never change during a game
+		if(kCivInfo.getCivilizationUnits(eUnitClass) != eUnit)
+			continue;
+
+		if(pkUnitInfo->GetProductionCost() == -1)
+			continue;
+
+#if defined(MOD_BALANCE_CORE_MINOR_CIV_GIFT)
+		if(MOD_BALANCE_CORE_MINOR_CIV_GIFT && pkUnitInfo->IsMinorCivGift() && !isBarbarian())
+			continue;
+#endif
+
+		m_aeProductionUnitCandidates.push_back(eUnit);
+	}
+
+	const bool bNoEspionage = GC.getGame().isOption(GAMEOPTION_NO_ESPIONAGE);
+	for(int iI = 0; iI < GC.getNumBuildingInfos(); iI++)
+	{
+		const BuildingTypes eBuilding = (BuildingTypes)iI;
+		CvBuildingEntry* pkBuildingInfo = GC.getBuildingInfo(eBuilding);
+		if(pkBuildingInfo == NULL)
+			continue;
+
+		if(bNoEspionage && pkBuildingInfo->IsEspionage())
+			continue;
+
+		if(kCivInfo.getCivilizationBuildings(pkBuildingInfo->GetBuildingClassType()) != eBuilding)
+			continue;
+
+		if(pkBuildingInfo->GetProductionCost() == -1)
+			continue;
+
+		m_aeProductionBuildingCandidates.push_back(eBuilding);
+	}
+
+	m_bProductionCandidatesValid = true;
+}
+
 //	--------------------------------------------------------------------------------
 bool CvPlayer::canConstruct(BuildingTypes eBuilding, bool bContinue, bool bTestVisible, bool bIgnoreCost, CvString* toolTipSink) const
 {
@@ -18003,7 +18131,7 @@ int CvPlayer::GetCultureYieldFromPreviousTurns(int iGameTurn, int iNumPreviousTu
 			break;
 		}
 
-		int iTurnCulture = getReplayDataValue(getReplayDataSetIndex("REPLAYDATASET_CULTUREPERTURN"), iTurn);
+		int iTurnCulture = getReplayDataValue(getReplayDataSetIndex(REPLAYDATASET_CULTUREPERTURN), iTurn);
 		if (iTurnCulture >= 0)
 		{
 			iSum += iTurnCulture;
@@ -18032,7 +18160,7 @@ int CvPlayer::GetTourismYieldFromPreviousTurns(int iGameTurn, int iNumPreviousTu
 			break;
 		}
 
-		int iTurnTourism = getReplayDataValue(getReplayDataSetIndex("REPLAYDATASET_TOURISMPERTURN"), iTurn);
+		int iTurnTourism = getReplayDataValue(getReplayDataSetIndex(REPLAYDATASET_TOURISMPERTURN), iTurn);
 		if (iTurnTourism >= 0)
 		{
 			iSum += iTurnTourism;
@@ -19528,6 +19656,13 @@ void CvPlayer::CalculateNetHappiness()
 		return;
 	}
 
+	// Inside a batch, the outermost EndHappinessUpdateBatch does the work once
+	if(m_iHappinessUpdateBatchDepth > 0)
+	{
+		m_bHappinessUpdatePending = true;
+		return;
+	}
+
 	DoUpdateTotalHappiness();
 	DoUpdateTotalUnhappiness();
 
@@ -19542,6 +19677,30 @@ void CvPlayer::CalculateNetHappiness()
 	}
 }
 
+//	--------------------------------------------------------------------------------
+/// Start a run of changes (e.g. reshuffling a city's citizens) that would each ask for a full happiness recalculation
+/// until the batch ends, GetExcessHappiness(), IsEmpireUnhappy() etc keep returning the values from before it started
+void CvPlayer::BeginHappinessUpdateBatch()
+{
+	m_iHappinessUpdateBatchDepth++;
+}
+
+//	--------------------------------------------------------------------------------
+/// End a run of changes, recalculating happiness once if anything asked for it
+void CvPlayer::EndHappinessUpdateBatch()
+{
+	CvAssertMsg(m_iHappinessUpdateBatchDepth > 0, "Ending a happiness update batch that was never started");
+	if(m_iHappinessUpdateBatchDepth <= 0)
+		return;
+
+	m_iHappinessUpdateBatchDepth--;
+	if(m_iHappinessUpdateBatchDepth == 0 && m_bHappinessUpdatePending)
+	{
+		m_bHappinessUpdatePending = false;
+		CalculateNetHappiness();
+	}
+}
+
 #if defined(MOD_BALANCE_CORE_HAPPINESS_NATIONAL)
 int CvPlayer::GetYieldPerTurnFromHappiness(YieldTypes eYield, int iValue) const
 {
@@ -20068,7 +20227,7 @@ void CvPlayer::DoUprising()
 			UnitTypes eUnit = theGame.GetRandomSpawnUnitType(GetID(), /*bIncludeUUs*/ false, /*bIncludeRanged*/ false);
 
 			CvNotifications* pNotifications = GetNotifications();
-			if(pNotifications)
+			if(pNotifications && pNotifications->IsRecording())
 			{
 				Localization::String strMessage = Localization::Lookup("TXT_KEY_NOTIFICATION_REBELS");
 				Localization::String strSummary = Localization::Lookup("TXT_KEY_NOTIFICATION_REBELS_SUMMARY");
@@ -20209,7 +20368,7 @@ void CvPlayer::DoCityRevolt()
 			PlayerTypes eNotifyPlayer = (PlayerTypes) iNotifyLoop;
 			CvPlayerAI& kCurNotifyPlayer = GET_PLAYER(eNotifyPlayer);
 			CvNotifications* pNotifications = kCurNotifyPlayer.GetNotifications();
-			if(pNotifications)
+			if(pNotifications && pNotifications->IsRecording())
 			{
 				Localization::String strMessage;
 				if (eNotifyPlayer == GetID())
@@ -21064,7 +21223,11 @@ int CvPlayer::DoUpdateTotalUnhappiness(CvCity* pAssumeCityAnnexed, CvCity* pAssu
 		iUnhappiness /= 100;
 	}
 
-	SetUnhappiness(iUnhappiness);
+	// What-if queries (annexing or puppeting a city) must not overwrite the real total
+	if(pAssumeCityAnnexed == NULL && pAssumeCityPuppeted == NULL)
+	{
+		SetUnhappiness(iUnhappiness);
+	}
 	return iUnhappiness;
 }
 
@@ -23810,7 +23973,7 @@ void CvPlayer::changeGoldenAgeTurns(int iChange)
 			}
 
 			CvNotifications* pNotifications = GetNotifications();
-			if(pNotifications)
+			if(pNotifications && pNotifications->IsRecording())
 			{
 				NotificationTypes eNotification = NO_NOTIFICATION_TYPE;
 
@@ -26224,7 +26387,7 @@ void CvPlayer::DoSpawnGreatPerson(PlayerTypes eMinor)
 					{
 						pCity->ChangeWeLoveTheKingDayCounter(iWLTKD);
 						CvNotifications* pNotifications = GetNotifications();
-						if (pNotifications)
+						if (pNotifications && pNotifications->IsRecording())
 						{
 							Localization::String strText = Localization::Lookup("TXT_KEY_NOTIFICATION_CITY_WLTKD_UA");
 							strText << pNewGreatPeople->getNameKey() << pCity->getNameKey();
@@ -26250,7 +26413,7 @@ void CvPlayer::DoSpawnGreatPerson(PlayerTypes eMinor)
 						{
 							pLoopCity->ChangeWeLoveTheKingDayCounter(iWLTKD);
 							CvNotifications* pNotifications = GetNotifications();
-							if (pNotifications)
+							if (pNotifications && pNotifications->IsRecording())
 							{
 								Localization::String strText = Localization::Lookup("TXT_KEY_NOTIFICATION_CITY_WLTKD_UNIT");
 								strText << pNewGreatPeople->getNameKey() << pLoopCity->getNameKey();
@@ -26277,7 +26440,7 @@ void CvPlayer::DoSpawnGreatPerson(PlayerTypes eMinor)
 					getCapitalCity()->ChangeJONSCultureStored(iValue);
 				}
 				CvNotifications* pNotifications = GetNotifications();
-				if (pNotifications)
+				if (pNotifications && pNotifications->IsRecording())
 				{
 					Localization::String strText = Localization::Lookup("TXT_KEY_NOTIFICATION_CULTURE_UNIT");
 					strText << pNewGreatPeople->getNameKey();
@@ -26434,7 +26597,7 @@ void CvPlayer::DoSpawnGreatPerson(PlayerTypes eMinor)
 			}
 
 			CvNotifications* pNotifications = GetNotifications();
-			if(pNotifications)
+			if(pNotifications && pNotifications->IsRecording())
 			{
 				Localization::String strMessage = Localization::Lookup("TXT_KEY_NOTIFICATION_CITY_STATE_UNIT_SPAWN");
 				strMessage << GET_PLAYER(eMinor).getNameKey();
@@ -26843,6 +27006,33 @@ void CvPlayer::ChangeInfluenceSpreadModifier(int iChange)
 	m_iInfluenceSpreadModifier = (m_iInfluenceSpreadModifier + iChange);
 }
 
+//	--------------------------------------------------------------------------------
+/// Does this player own a building which cancels the influence spread modifier of others (great firewall)?
+bool CvPlayer::HasInfluenceNullifyingBuilding() const
+{
+	return m_iNumInfluenceNullifyingBuildings > 0;
+}
+
+//	--------------------------------------------------------------------------------
+/// Recount from the buildings present in our cities, obsolete or not (as the old per-query scan did).
+/// Both CvCity::processBuilding and loading use this, so the count can't drift with the real/free building bookkeeping.
+void CvPlayer::UpdateNumInfluenceNullifyingBuildings()
+{
+	m_iNumInfluenceNullifyingBuildings = 0;
+
+	int iLoop;
+	for(const CvCity* pLoopCity = firstCity(&iLoop); pLoopCity != NULL; pLoopCity = nextCity(&iLoop))
+	{
+		const std::vector<BuildingTypes>& vBuildings = pLoopCity->GetCityBuildings()->GetAllBuildingsHere();
+		for(size_t i = 0; i < vBuildings.size(); i++)
+		{
+			CvBuildingEntry* pkBuildingInfo = GC.getBuildingInfo(vBuildings[i]);
+			if(pkBuildingInfo && pkBuildingInfo->NullifyInfluenceModifier())
+				m_iNumInfluenceNullifyingBuildings += pLoopCity->GetCityBuildings()->GetNumBuilding(vBuildings[i]);
+		}
+	}
+}
+
 //	--------------------------------------------------------------------------------
 int CvPlayer::GetExtraVotesPerDiplomat() const
 {
@@ -30900,7 +31090,7 @@ void CvPlayer::setDynamicTurnsSimultMode(bool simultaneousTurns)
 	if(simultaneousTurns != m_bDynamicTurnsSimultMode)
 	{
 		CvNotifications* pNotifications = GetNotifications();
-		if (pNotifications)
+		if (pNotifications && pNotifications->IsRecording())
 		{
 			NotificationTypes notifyType = NOTIFICATION_TURN_MODE_SEQUENTIAL;
 			Localization::String localizedText = Localization::Lookup("TXT_KEY_NOTIFICATION_TURN_MODE_SEQUENTIAL");
@@ -32664,7 +32854,7 @@ int CvPlayer::GetScienceYieldFromPreviousTurns(int iGameTurn, int iNumPreviousTu
 			break;
 		}
 
-		int iTurnScience = getReplayDataValue(getReplayDataSetIndex("REPLAYDATASET_SCIENCEPERTURN"), iTurn);
+		int iTurnScience = getReplayDataValue(getReplayDataSetIndex(REPLAYDATASET_SCIENCEPERTURN), iTurn);
 		if (iTurnScience >= 0)
 		{
 			iSum += iTurnScience;
@@ -32754,7 +32944,7 @@ void CvPlayer::DoDeficit()
 				if(pLandUnit)
 				{
 					CvNotifications* pNotifications = GetNotifications();
-					if(pNotifications)
+					if(pNotifications && pNotifications->IsRecording())
 					{
 						Localization::String locString = Localization::Lookup("TXT_KEY_NTFN_UNIT_DISBANDED");
 						Localization::String locSummary = Localization::Lookup("TXT_KEY_NTFN_UNIT_DISBANDED_S");
@@ -32770,7 +32960,7 @@ void CvPlayer::DoDeficit()
 				if(pNavalUnit)
 				{
 					CvNotifications* pNotifications = GetNotifications();
-					if(pNotifications)
+					if(pNotifications && pNotifications->IsRecording())
 					{
 						Localization::String locString = Localization::Lookup("TXT_KEY_NTFN_UNIT_DISBANDED");
 						Localization::String locSummary = Localization::Lookup("TXT_KEY_NTFN_UNIT_DISBANDED_S");
@@ -34639,7 +34829,7 @@ void CvPlayer::DoTestOverResourceNotification(ResourceTypes eIndex)
 		if(pkResourceInfo != NULL && pkResourceInfo->getResourceUsage() == RESOURCEUSAGE_STRATEGIC)
 		{
 			CvNotifications* pNotifications = GetNotifications();
-			if(pNotifications)
+			if(pNotifications && pNotifications->IsRecording())
 			{
 				Localization::String strText = Localization::Lookup("TXT_KEY_NOTIFICATION_OVER_RESOURCE_LIMIT");
 				strText << pkResourceInfo->GetTextKey();
@@ -37293,32 +37483,40 @@ const char* CvPlayer::getReplayDataSetName(unsigned int idx) const
 //	--------------------------------------------------------------------------------
 unsigned int CvPlayer::getReplayDataSetIndex(const char* szDataSetName)
 {
-	CvString dataSetName = szDataSetName;
-
 	unsigned int idx = 0;
 	for(std::vector<CvString>::iterator it = m_ReplayDataSets.begin(); it != m_ReplayDataSets.end(); ++it)
 	{
-		if((*it) == dataSetName)
+		if(strcmp(it->c_str(), szDataSetName) == 0)
 			return idx;
 
 		idx++;
 	}
 
-	m_ReplayDataSets.push_back(dataSetName);
-	m_ReplayDataSetValues.push_back(TurnData());
+	m_ReplayDataSets.push_back(szDataSetName);
+	m_ReplayDataSetValues.push_back(TurnValues());
 	return m_ReplayDataSets.size() - 1;
 }
 
+//	--------------------------------------------------------------------------------
+/// Same as above for the data sets the game records every turn, without comparing names each time
+unsigned int CvPlayer::getReplayDataSetIndex(BuiltInReplayDataSetTypes eDataSet)
+{
+	unsigned int& uiIndex = m_auiBuiltInReplayDataSets[eDataSet];
+	if(uiIndex == NO_REPLAYDATASET)
+		uiIndex = getReplayDataSetIndex(s_aszBuiltInReplayDataSetNames[eDataSet]);
+
+	return uiIndex;
+}
+
 //	--------------------------------------------------------------------------------
 int CvPlayer::getReplayDataValue(unsigned int uiDataSet, unsigned int uiTurn) const
 {
 	if(uiDataSet < m_ReplayDataSetValues.size())
 	{
-		const TurnData& dataSet = m_ReplayDataSetValues[uiDataSet];
-		TurnData::const_iterator it = dataSet.find(uiTurn);
-		if(it != dataSet.end())
+		const TurnValues& dataSet = m_ReplayDataSetValues[uiDataSet];
+		if(uiTurn < dataSet.size() && dataSet[uiTurn] != REPLAY_DATA_NO_VALUE)
 		{
-			return (*it).second;
+			return dataSet[uiTurn];
 		}
 	}
 
@@ -37329,20 +37527,31 @@ void CvPlayer::setReplayDataValue(unsigned int uiDataSet, unsigned int uiTurn, i
 {
 	if(uiDataSet < m_ReplayDataSetValues.size())
 	{
-		TurnData& dataSet = m_ReplayDataSetValues[uiDataSet];
-		dataSet[uiTurn] = iValue;
+		//the storage is dense, so refuse nonsense turns instead of allocating for them
+		CvAssertMsg(uiTurn < (unsigned int)REPLAY_DATA_MAX_TURN, "Replay data turn out of range");
+		if(uiTurn >= (unsigned int)REPLAY_DATA_MAX_TURN)
+			return;
+
+		TurnValues& dataSet = m_ReplayDataSetValues[uiDataSet];
+		if(uiTurn >= dataSet.size())
+			dataSet.resize(uiTurn + 1, REPLAY_DATA_NO_VALUE);
+
+		//the sentinel is reserved, keep a real value from reading as a gap
+		dataSet[uiTurn] = (iValue == REPLAY_DATA_NO_VALUE) ? REPLAY_DATA_NO_VALUE + 1 : iValue;
 	}
 }
 
 //	--------------------------------------------------------------------------------
-CvPlayer::TurnData CvPlayer::getReplayDataHistory(unsigned int uiDataSet) const
+/// Values for all turns, turns without data hold REPLAY_DATA_NO_VALUE
+const CvPlayer::TurnValues& CvPlayer::getReplayDataHistory(unsigned int uiDataSet) const
 {
 	if(uiDataSet < m_ReplayDataSetValues.size())
 	{
 		return m_ReplayDataSetValues[uiDataSet];
 	}
 
-	return CvPlayer::TurnData();
+	static const TurnValues emptyHistory;
+	return emptyHistory;
 }
 
 //	--------------------------------------------------------------------------------
@@ -39435,7 +39644,7 @@ void CvPlayer::processPolicies(PolicyTypes ePolicy, int iChange)
 						locSummary = Localization::Lookup("TXT_KEY_NOTIFICATION_SUMMARY_MINOR_FRIENDSHIP_DECAY");
 
 						pNotifications = GET_PLAYER(ePlayer).GetNotifications();
-						if(pNotifications)
+						if(pNotifications && pNotifications->IsRecording())
 						{
 							pNotifications->Add(NOTIFICATION_DIPLOMACY_DECLARATION, locString.toUTF8(), locSummary.toUTF8(), -1, -1, -1);
 						}
@@ -39449,7 +39658,7 @@ void CvPlayer::processPolicies(PolicyTypes ePolicy, int iChange)
 					locSummary = Localization::Lookup("TXT_KEY_NOTIFICATION_SUMMARY_MINOR_FRIENDSHIP_DECAY");
 
 					pNotifications = GET_PLAYER(ePlayer).GetNotifications();
-					if(pNotifications)
+					if(pNotifications && pNotifications->IsRecording())
 					{
 						pNotifications->Add(NOTIFICATION_DIPLOMACY_DECLARATION, locString.toUTF8(), locSummary.toUTF8(), -1, -1, -1);
 					}
@@ -39923,7 +40132,7 @@ void CvPlayer::processPolicies(PolicyTypes ePolicy, int iChange)
 												{
 													pLoopCity->ChangeWeLoveTheKingDayCounter(iWLTKD);
 													CvNotifications* pNotifications = GetNotifications();
-													if (pNotifications)
+													if (pNotifications && pNotifications->IsRecording())
 													{
 														Localization::String strText = Localization::Lookup("TXT_KEY_NOTIFICATION_CITY_WLTKD_UNIT");
 														strText << pNewUnit->getNameKey() << pLoopCity->getNameKey();
@@ -39950,7 +40159,7 @@ void CvPlayer::processPolicies(PolicyTypes ePolicy, int iChange)
 											getCapitalCity()->ChangeJONSCultureStored(iValue);
 										}
 										CvNotifications* pNotifications = GetNotifications();
-										if (pNotifications)
+										if (pNotifications && pNotifications->IsRecording())
 										{
 											Localization::String strText = Localization::Lookup("TXT_KEY_NOTIFICATION_CULTURE_UNIT");
 											strText << pNewUnit->getNameKey();
@@ -40550,7 +40759,7 @@ void CvPlayer::processPolicies(PolicyTypes ePolicy, int iChange)
 #endif
 	{
 		pNotifications = GetNotifications();
-		if(pNotifications)
+		if(pNotifications && pNotifications->IsRecording())
 		{
 			CvString strBuffer = GetLocalizedText("TXT_KEY_NOTIFICATION_ADD_REFORMATION_BELIEF");
 			CvString strSummary = GetLocalizedText("TXT_KEY_NOTIFICATION_SUMMARY_ADD_REFORMATION_BELIEF");
@@ -40931,6 +41140,156 @@ bool CvPlayer::HasActiveDiplomacyRequests() const
 	return false;
 }
 
+//	--------------------------------------------------------------------------------
+/// Simple FNV-1a hash over a save chunk, enough to detect a damaged or mismatched subsystem
+static uint GetSaveChunkChecksum(const char* pData, uint uiSize)
+{
+	uint uiHash = 2166136261u;
+	for(uint i = 0; i < uiSize; i++)
+	{
+		uiHash ^= (unsigned char)pData[i];
+		uiHash *= 16777619u;
+	}
+	return uiHash;
+}
+
+//	--------------------------------------------------------------------------------
+/// Collects one subsystem in memory and appends it to the save as (size, checksum, payload) when it goes out of scope.
+/// Tools can walk or skip chunks without knowing how to parse their content.
+class CvPlayerChunkWriter
+{
+public:
+	CvPlayerChunkWriter(FDataStream& kStream) : m_kStream(kStream) {}
+	~CvPlayerChunkWriter()
+	{
+		uint uiSize = m_kChunk.GetEOF();
+		m_kStream << uiSize;
+		m_kStream << GetSaveChunkChecksum(m_kChunk.GetBuf(), uiSize);
+		if(uiSize > 0)
+			m_kStream.WriteIt(uiSize, m_kChunk.GetBuf());
+	}
+	FDataStream& stream() { return m_kChunk; }
+
+private:
+	FDataStream& m_kStream;
+	FMemoryStream m_kChunk;
+};
+
+//	--------------------------------------------------------------------------------
+/// Read-only stream over the payload of one chunk. Reading past the end yields zeros instead of running into the next chunk.
+class CvPlayerChunkStream : public FDataStream
+{
+public:
+	CvPlayerChunkStream() : m_uiPosition(0) {}
+
+	std::vector<char>& buffer() { return m_vBuffer; }
+
+	virtual unsigned int ReadIt(unsigned int byteCount, void* buffer)
+	{
+		unsigned int uiAvailable = std::min(byteCount, (unsigned int)m_vBuffer.size() - m_uiPosition);
+		if(uiAvailable > 0)
+			memcpy(buffer, &m_vBuffer[m_uiPosition], uiAvailable);
+		if(uiAvailable < byteCount)
+			memset((char*)buffer + uiAvailable, 0, byteCount - uiAvailable);
+
+		m_uiPosition += uiAvailable;
+		return uiAvailable;
+	}
+	virtual unsigned int WriteIt(unsigned int, const void*)
+	{
+		CvAssertMsg(false, "Player save chunks are read-only");
+		return 0;
+	}
+	virtual void Skip(unsigned int deltaByteCount) { m_uiPosition = std::min(m_uiPosition + deltaByteCount, (unsigned int)m_vBuffer.size()); }
+	virtual void Rewind() { m_uiPosition = 0; }
+	virtual bool AtEnd() const { return m_uiPosition >= m_vBuffer.size(); }
+	virtual void FastFwd() { m_uiPosition = m_vBuffer.size(); }
+
+private:
+	std::vector<char> m_vBuffer;
+	unsigned int m_uiPosition;
+};
+
+//	--------------------------------------------------------------------------------
+/// Counterpart of CvPlayerChunkWriter. Older saves have no chunks, then the subsystem reads straight from the save.
+/// A subsystem that does not consume its whole chunk can no longer throw the rest of the player data off.
+/// A damaged chunk fails the load, a half-loaded player (eg without its cities while the plots still point to them) is worse than no game.
+class CvPlayerChunkReader
+{
+public:
+	CvPlayerChunkReader(FDataStream& kStream, uint uiVersion) : m_kStream(kStream), m_bChunked(uiVersion >= (uint)g_FirstChunkedCvPlayerVersion)
+	{
+		if(!m_bChunked)
+			return;
+
+		if(m_kStream.AtEnd())
+		{
+			Fail("save ends before the chunk", 0, 0, 0);
+			return;
+		}
+
+		uint uiSize = 0, uiChecksum = 0;
+		m_kStream >> uiSize;
+		m_kStream >> uiChecksum;
+
+		//a garbage size must not turn into a huge allocation
+		if(uiSize > (uint)g_MaxCvPlayerChunkSize)
+		{
+			Fail("size out of range", uiSize, 0, uiChecksum);
+			return;
+		}
+
+		std::vector<char>& vBuffer = m_kChunk.buffer();
+		vBuffer.resize(uiSize);
+		if(uiSize > 0 && m_kStream.ReadIt(uiSize, &vBuffer[0]) != uiSize)
+		{
+			Fail("save ends inside the chunk", uiSize, 0, uiChecksum);
+			return;
+		}
+
+		uint uiActualChecksum = GetSaveChunkChecksum(uiSize > 0 ? &vBuffer[0] : NULL, uiSize);
+		if(uiActualChecksum != uiChecksum)
+			Fail("checksum mismatch", uiSize, uiActualChecksum, uiChecksum);
+	}
+	~CvPlayerChunkReader()
+	{
+		CvAssertMsg(!m_bChunked || m_kChunk.AtEnd(), "Player save chunk was not read completely");
+	}
+	FDataStream& stream() { return m_bChunked ? m_kChunk : m_kStream; }
+
+private:
+	/// Log the damage and abort the load through the save stream
+	void Fail(const char* szReason, uint uiSize, uint uiActualChecksum, uint uiExpectedChecksum)
+	{
+		CvAssertMsg(false, "Damaged player save chunk, the save cannot be loaded");
+
+		FILogFile* pLog = LOGFILEMGR.GetLog("SaveChunkErrors.log", FILogFile::kDontTimeStamp);
+		if(pLog)
+		{
+			CvString strMsg;
+			strMsg.Format("Damaged player save chunk (%s), %u bytes, checksum %08x, expected %08x. Load aborted.", szReason, uiSize, uiActualChecksum, uiExpectedChecksum);
+			pLog->Msg(strMsg);
+		}
+
+		//nothing after this point can be trusted to be aligned, make sure nobody parses any of it
+		m_kChunk.buffer().clear();
+		m_kStream.FastFwd();
+
+		CvPlayerChunkError kError;
+		m_kStream.RaiseException(kError);
+	}
+
+	class CvPlayerChunkError : public std::exception
+	{
+	public:
+		virtual const char* what() const throw() { return "damaged player save chunk"; }
+	};
+
+	FDataStream& m_kStream;
+	CvPlayerChunkStream m_kChunk;
+	bool m_bChunked;
+};
+
 //	--------------------------------------------------------------------------------
 //
 // read object from a stream
@@ -40951,49 +41310,53 @@ void CvPlayer::Read(FDataStream& kStream)
 	//Values below deleted, as they're already in the sync archive! Use the sync archive from now on!
 #endif
 
-	m_pPlayerPolicies->Read(kStream);
-	m_pEconomicAI->Read(kStream);
-	m_pCitySpecializationAI->Read(kStream);
-	m_pWonderProductionAI->Read(kStream);
-	m_pMilitaryAI->Read(kStream);
-	m_pGrandStrategyAI->Read(kStream);
-	m_pDiplomacyAI->Read(kStream);
-	m_pReligions->Read(kStream);
-	m_pReligionAI->Read(kStream);
+	// each temporary chunk reader lives until the end of its statement
+	m_pPlayerPolicies->Read(CvPlayerChunkReader(kStream, uiVersion).stream());
+	m_pEconomicAI->Read(CvPlayerChunkReader(kStream, uiVersion).stream());
+	m_pCitySpecializationAI->Read(CvPlayerChunkReader(kStream, uiVersion).stream());
+	m_pWonderProductionAI->Read(CvPlayerChunkReader(kStream, uiVersion).stream());
+	m_pMilitaryAI->Read(CvPlayerChunkReader(kStream, uiVersion).stream());
+	m_pGrandStrategyAI->Read(CvPlayerChunkReader(kStream, uiVersion).stream());
+	m_pDiplomacyAI->Read(CvPlayerChunkReader(kStream, uiVersion).stream());
+	m_pReligions->Read(CvPlayerChunkReader(kStream, uiVersion).stream());
+	m_pReligionAI->Read(CvPlayerChunkReader(kStream, uiVersion).stream());
 #if defined(MOD_BALANCE_CORE)
-	m_pCorporations->Read(kStream);
-#endif
-	m_pPlayerTechs->Read(kStream);
-	m_pFlavorManager->Read(kStream);
-	m_pTacticalAI->Read(kStream);
-	m_pHomelandAI->Read(kStream);
-	m_pMinorCivAI->Read(kStream);
-	m_pDealAI->Read(kStream);
-	m_pBuilderTaskingAI->Read(kStream);
-	m_pCityConnections->Read(kStream);
+	m_pCorporations->Read(CvPlayerChunkReader(kStream, uiVersion).stream());
+#endif
+	m_pPlayerTechs->Read(CvPlayerChunkReader(kStream, uiVersion).stream());
+	m_pFlavorManager->Read(CvPlayerChunkReader(kStream, uiVersion).stream());
+	m_pTacticalAI->Read(CvPlayerChunkReader(kStream, uiVersion).stream());
+	m_pHomelandAI->Read(CvPlayerChunkReader(kStream, uiVersion).stream());
+	m_pMinorCivAI->Read(CvPlayerChunkReader(kStream, uiVersion).stream());
+	m_pDealAI->Read(CvPlayerChunkReader(kStream, uiVersion).stream());
+	m_pBuilderTaskingAI->Read(CvPlayerChunkReader(kStream, uiVersion).stream());
+	m_pCityConnections->Read(CvPlayerChunkReader(kStream, uiVersion).stream());
 #if defined(MOD_BALANCE_CORE)
 	SetDangerPlotsDirty();
 #else
-	m_pDangerPlots->Read(kStream);
+	m_pDangerPlots->Read(CvPlayerChunkReader(kStream, uiVersion).stream());
 #endif
-	m_pTraits->Read(kStream);
-	kStream >> *m_pEspionage;
-	kStream >> *m_pEspionageAI;
-	kStream >> *m_pTrade;
-	kStream >> *m_pTradeAI;
-	m_pLeagueAI->Read(kStream);
-	kStream >> *m_pCulture;
+	m_pTraits->Read(CvPlayerChunkReader(kStream, uiVersion).stream());
+	CvPlayerChunkReader(kStream, uiVersion).stream() >> *m_pEspionage;
+	CvPlayerChunkReader(kStream, uiVersion).stream() >> *m_pEspionageAI;
+	CvPlayerChunkReader(kStream, uiVersion).stream() >> *m_pTrade;
+	CvPlayerChunkReader(kStream, uiVersion).stream() >> *m_pTradeAI;
+	m_pLeagueAI->Read(CvPlayerChunkReader(kStream, uiVersion).stream());
+	CvPlayerChunkReader(kStream, uiVersion).stream() >> *m_pCulture;
 
-	bool bReadNotifications;
-	kStream >> bReadNotifications;
-	if(bReadNotifications)
 	{
-		if (!m_pNotifications)
-			m_pNotifications = FNEW(CvNotifications, c_eCiv5GameplayDLL, 0);
-		m_pNotifications->Init(GetID());
-		m_pNotifications->Read(kStream);
+		CvPlayerChunkReader kChunk(kStream, uiVersion);
+		bool bReadNotifications;
+		kChunk.stream() >> bReadNotifications;
+		if(bReadNotifications)
+		{
+			if (!m_pNotifications)
+				m_pNotifications = FNEW(CvNotifications, c_eCiv5GameplayDLL, 0);
+			m_pNotifications->Init(GetID());
+			m_pNotifications->Read(kChunk.stream());
+		}
 	}
-	m_pTreasury->Read(kStream);
+	m_pTreasury->Read(CvPlayerChunkReader(kStream, uiVersion).stream());
 
 	// If this is a real player, hook up the player-level flavor recipients
 	if(GetID() != NO_PLAYER)
@@ -41015,26 +41378,30 @@ void CvPlayer::Read(FDataStream& kStream)
 
 	kStream >> m_cityNames;
 
-	kStream >> m_cities;
+	CvPlayerChunkReader(kStream, uiVersion).stream() >> m_cities;
 #if defined(MOD_BALANCE_CORE_SETTLER)
 	SetClosestCityMapDirty();
 #endif
 
-	kStream >> m_units;
-	kStream >> m_armyAIs;
+	// derived from the buildings, so rebuild it instead of saving it
+	UpdateNumInfluenceNullifyingBuildings();
+
+	CvPlayerChunkReader(kStream, uiVersion).stream() >> m_units;
+	CvPlayerChunkReader(kStream, uiVersion).stream() >> m_armyAIs;
 
 	{
+		CvPlayerChunkReader kChunk(kStream, uiVersion);
 		m_AIOperations.clear();
 		uint iSize;
 		int iID;
 		int iOperationType;
-		kStream >> iSize;
+		kChunk.stream() >> iSize;
 		for(uint i = 0; i < iSize; i++)
 		{
-			kStream >> iID;
-			kStream >> iOperationType;
+			kChunk.stream() >> iID;
+			kChunk.stream() >> iOperationType;
 			CvAIOperation* pThisOperation = CvAIOperation::CreateOperation((AIOperationTypes)iOperationType);
-			pThisOperation->Read(kStream);
+			pThisOperation->Read(kChunk.stream());
 			m_AIOperations.insert(std::make_pair(pThisOperation->GetID(), pThisOperation));
 		}
 	}
@@ -41048,7 +41415,25 @@ void CvPlayer::Read(FDataStream& kStream)
 	}
 
 	kStream >> m_ReplayDataSets;
-	kStream >> m_ReplayDataSetValues;
+	if (uiVersion >= (uint)g_FirstDenseReplayDataCvPlayerVersion)
+	{
+		kStream >> m_ReplayDataSetValues;
+	}
+	else
+	{
+		std::vector<TurnData> replayDataSetValues;
+		kStream >> replayDataSetValues;
+		m_ReplayDataSetValues.clear();
+		m_ReplayDataSetValues.resize(replayDataSetValues.size());
+		for(size_t i = 0; i < replayDataSetValues.size(); i++)
+		{
+			for(TurnData::const_iterator it = replayDataSetValues[i].begin(); it != replayDataSetValues[i].end(); ++it)
+				setReplayDataValue(i, it->first, it->second);
+		}
+	}
+	//the loaded data sets may be in a different order
+	for(int i = 0; i < NUM_BUILTIN_REPLAYDATASETS; i++)
+		m_auiBuiltInReplayDataSets[i] = NO_REPLAYDATASET;
 
 	kStream >> m_aVote;
 	kStream >> m_aUnitExtraCosts;
@@ -41177,47 +41562,51 @@ void CvPlayer::Write(FDataStream& kStream) const
 	kStream << m_syncArchive;
 	//Values below deleted, as they're already in the sync archive! Use the sync archive from now on!
 #endif
-	m_pPlayerPolicies->Write(kStream);
-	m_pEconomicAI->Write(kStream);
-	m_pCitySpecializationAI->Write(kStream);
-	m_pWonderProductionAI->Write(kStream);
-	m_pMilitaryAI->Write(kStream);
-	m_pGrandStrategyAI->Write(kStream);
-	m_pDiplomacyAI->Write(kStream);
-	m_pReligions->Write(kStream);
-	m_pReligionAI->Write(kStream);
+	// each temporary chunk writer flushes its chunk at the end of its statement
+	m_pPlayerPolicies->Write(CvPlayerChunkWriter(kStream).stream());
+	m_pEconomicAI->Write(CvPlayerChunkWriter(kStream).stream());
+	m_pCitySpecializationAI->Write(CvPlayerChunkWriter(kStream).stream());
+	m_pWonderProductionAI->Write(CvPlayerChunkWriter(kStream).stream());
+	m_pMilitaryAI->Write(CvPlayerChunkWriter(kStream).stream());
+	m_pGrandStrategyAI->Write(CvPlayerChunkWriter(kStream).stream());
+	m_pDiplomacyAI->Write(CvPlayerChunkWriter(kStream).stream());
+	m_pReligions->Write(CvPlayerChunkWriter(kStream).stream());
+	m_pReligionAI->Write(CvPlayerChunkWriter(kStream).stream());
 #if defined(MOD_BALANCE_CORE)
-	m_pCorporations->Write(kStream);
-#endif
-	m_pPlayerTechs->Write(kStream);
-	m_pFlavorManager->Write(kStream);
-	m_pTacticalAI->Write(kStream);
-	m_pHomelandAI->Write(kStream);
-	m_pMinorCivAI->Write(kStream);
-	m_pDealAI->Write(kStream);
-	m_pBuilderTaskingAI->Write(kStream);
-	m_pCityConnections->Write(kStream);
+	m_pCorporations->Write(CvPlayerChunkWriter(kStream).stream());
+#endif
+	m_pPlayerTechs->Write(CvPlayerChunkWriter(kStream).stream());
+	m_pFlavorManager->Write(CvPlayerChunkWriter(kStream).stream());
+	m_pTacticalAI->Write(CvPlayerChunkWriter(kStream).stream());
+	m_pHomelandAI->Write(CvPlayerChunkWriter(kStream).stream());
+	m_pMinorCivAI->Write(CvPlayerChunkWriter(kStream).stream());
+	m_pDealAI->Write(CvPlayerChunkWriter(kStream).stream());
+	m_pBuilderTaskingAI->Write(CvPlayerChunkWriter(kStream).stream());
+	m_pCityConnections->Write(CvPlayerChunkWriter(kStream).stream());
 #if !defined(MOD_BALANCE_CORE)
-	m_pDangerPlots->Write(kStream);
+	m_pDangerPlots->Write(CvPlayerChunkWriter(kStream).stream());
 #endif
-	m_pTraits->Write(kStream);
-	kStream << *m_pEspionage;
-	kStream << *m_pEspionageAI;
-	kStream << *m_pTrade;
-	kStream << *m_pTradeAI;
-	m_pLeagueAI->Write(kStream);
-	kStream << *m_pCulture;
+	m_pTraits->Write(CvPlayerChunkWriter(kStream).stream());
+	CvPlayerChunkWriter(kStream).stream() << *m_pEspionage;
+	CvPlayerChunkWriter(kStream).stream() << *m_pEspionageAI;
+	CvPlayerChunkWriter(kStream).stream() << *m_pTrade;
+	CvPlayerChunkWriter(kStream).stream() << *m_pTradeAI;
+	m_pLeagueAI->Write(CvPlayerChunkWriter(kStream).stream());
+	CvPlayerChunkWriter(kStream).stream() << *m_pCulture;
 
-	if(m_pNotifications)
-	{
-		kStream << true;
-		m_pNotifications->Write(kStream);
-	}
-	else
 	{
-		kStream << false;
+		CvPlayerChunkWriter kChunk(kStream);
+		if(m_pNotifications)
+		{
+			kChunk.stream() << true;
+			m_pNotifications->Write(kChunk.stream());
+		}
+		else
+		{
+			kChunk.stream() << false;
+		}
 	}
-	m_pTreasury->Write(kStream);
+	m_pTreasury->Write(CvPlayerChunkWriter(kStream).stream());
 
 	kStream << m_UnitCycle;
 	kStream << m_researchQueue;
@@ -41226,20 +41615,21 @@ void CvPlayer::Write(FDataStream& kStream) const
 	kStream << m_iEndTurnBlockingNotificationIndex;
 
 	kStream << m_cityNames;
-	kStream << m_cities;
-	kStream << m_units;
-	kStream << m_armyAIs;
+	CvPlayerChunkWriter(kStream).stream() << m_cities;
+	CvPlayerChunkWriter(kStream).stream() << m_units;
+	CvPlayerChunkWriter(kStream).stream() << m_armyAIs;
 
 	{
+		CvPlayerChunkWriter kChunk(kStream);
 		uint iSize = m_AIOperations.size();
-		kStream << iSize;
+		kChunk.stream() << iSize;
 		std::map<int, CvAIOperation*>::const_iterator it;
 		for(it = m_AIOperations.begin(); it != m_AIOperations.end(); ++it)
 		{
-			kStream << it->first;
+			kChunk.stream() << it->first;
 			CvAIOperation* pThisOperation = it->second;
-			kStream << pThisOperation->GetOperationType();
-			pThisOperation->Write(kStream);
+			kChunk.stream() << pThisOperation->GetOperationType();
+			pThisOperation->Write(kChunk.stream());
 		}
 	}
 
@@ -41350,7 +41740,7 @@ void CvPlayer::createGreatGeneral(UnitTypes eGreatPersonUnit, int iX, int iY)
 			{
 				pCity->ChangeWeLoveTheKingDayCounter(iWLTKD);
 				CvNotifications* pNotifications = GetNotifications();
-				if (pNotifications)
+				if (pNotifications && pNotifications->IsRecording())
 				{
 					Localization::String strText = Localization::Lookup("TXT_KEY_NOTIFICATION_CITY_WLTKD_UA");
 					strText << pGreatPeopleUnit->getNameKey() << pCity->getNameKey();
@@ -41376,7 +41766,7 @@ void CvPlayer::createGreatGeneral(UnitTypes eGreatPersonUnit, int iX, int iY)
 				{
 					pLoopCity->ChangeWeLoveTheKingDayCounter(iWLTKD);
 					CvNotifications* pNotifications = GetNotifications();
-					if (pNotifications)
+					if (pNotifications && pNotifications->IsRecording())
 					{
 						Localization::String strText = Localization::Lookup("TXT_KEY_NOTIFICATION_CITY_WLTKD_UNIT");
 						strText << pGreatPeopleUnit->getNameKey() << pLoopCity->getNameKey();
@@ -41403,7 +41793,7 @@ void CvPlayer::createGreatGeneral(UnitTypes eGreatPersonUnit, int iX, int iY)
 			getCapitalCity()->ChangeJONSCultureStored(iValue);
 		}
 		CvNotifications* pNotifications = GetNotifications();
-		if (pNotifications)
+		if (pNotifications && pNotifications->IsRecording())
 		{
 			Localization::String strText = Localization::Lookup("TXT_KEY_NOTIFICATION_CULTURE_UNIT");
 			strText << pGreatPeopleUnit->getNameKey();
@@ -41535,7 +41925,7 @@ void CvPlayer::createGreatAdmiral(UnitTypes eGreatPersonUnit, int iX, int iY)
 			{
 				pCity->ChangeWeLoveTheKingDayCounter(iWLTKD);
 				CvNotifications* pNotifications = GetNotifications();
-				if (pNotifications)
+				if (pNotifications && pNotifications->IsRecording())
 				{
 					Localization::String strText = Localization::Lookup("TXT_KEY_NOTIFICATION_CITY_WLTKD_UA");
 					strText << pGreatPeopleUnit->getNameKey() << pCity->getNameKey();
@@ -41561,7 +41951,7 @@ void CvPlayer::createGreatAdmiral(UnitTypes eGreatPersonUnit, int iX, int iY)
 				{
 					pLoopCity->ChangeWeLoveTheKingDayCounter(iWLTKD);
 					CvNotifications* pNotifications = GetNotifications();
-					if (pNotifications)
+					if (pNotifications && pNotifications->IsRecording())
 					{
 						Localization::String strText = Localization::Lookup("TXT_KEY_NOTIFICATION_CITY_WLTKD_UNIT");
 						strText << pGreatPeopleUnit->getNameKey() << pLoopCity->getNameKey();
@@ -41588,7 +41978,7 @@ void CvPlayer::createGreatAdmiral(UnitTypes eGreatPersonUnit, int iX, int iY)
 			getCapitalCity()->ChangeJONSCultureStored(iValue);
 		}
 		CvNotifications* pNotifications = GetNotifications();
-		if (pNotifications)
+		if (pNotifications && pNotifications->IsRecording())
 		{
 			Localization::String strText = Localization::Lookup("TXT_KEY_NOTIFICATION_CULTURE_UNIT");
 			strText << pGreatPeopleUnit->getNameKey();
@@ -43807,7 +44197,7 @@ void CvPlayer::ChangeNumFreePolicies(int iChange)
 	if(iChange > 0 && getNumCities() > 0)
 	{
 		CvNotifications* pNotifications = GetNotifications();
-		if(pNotifications)
+		if(pNotifications && pNotifications->IsRecording())
 		{
 			CvString strBuffer = GetLocalizedText("TXT_KEY_NOTIFICATION_FREE_POLICY");
 			CvString strSummary = GetLocalizedText("TXT_KEY_NOTIFICATION_FREE_POLICY_SUMMARY");
@@ -43844,7 +44234,7 @@ void CvPlayer::ChangeNumFreeTenets(int iChange, bool bCountAsFreePolicies)
 	if(iChange > 0 && getNumCities() > 0)
 	{
 		CvNotifications* pNotifications = GetNotifications();
-		if(pNotifications)
+		if(pNotifications && pNotifications->IsRecording())
 		{
 			CvString strBuffer = GetLocalizedText("TXT_KEY_NOTIFICATION_FREE_POLICY");
 			CvString strSummary = GetLocalizedText("TXT_KEY_NOTIFICATION_FREE_POLICY_SUMMARY");
@@ -43875,7 +44265,7 @@ void CvPlayer::ChangeNumFreeGreatPeople(int iChange)
 		if(isHuman())
 		{
 			CvNotifications* pNotifications = GetNotifications();
-			if(pNotifications)
+			if(pNotifications && pNotifications->IsRecording())
 			{
 				CvString strBuffer = GetLocalizedText("TXT_KEY_CHOOSE_FREE_GREAT_PERSON");
 				CvString strSummary = GetLocalizedText("TXT_KEY_CHOOSE_FREE_GREAT_PERSON_TT");
@@ -43913,7 +44303,7 @@ void CvPlayer::ChangeNumMayaBoosts(int iChange)
 		if(isHuman())
 		{
 			CvNotifications* pNotifications = GetNotifications();
-			if(pNotifications)
+			if(pNotifications && pNotifications->IsRecording())
 			{
 				CvString strBuffer = GetLocalizedText("TXT_KEY_NOTIFICATION_MAYA_LONG_COUNT");
 				CvString strSummary = GetLocalizedText("TXT_KEY_NOTIFICATION_MAYA_LONG_COUNT_TT");
@@ -43951,7 +44341,7 @@ void CvPlayer::ChangeNumFaithGreatPeople(int iChange)
 		if(isHuman())
 		{
 			CvNotifications* pNotifications = GetNotifications();
-			if(pNotifications)
+			if(pNotifications && pNotifications->IsRecording())
 			{
 				CvString strBuffer = GetLocalizedText("TXT_KEY_NOTIFICATION_FAITH_GREAT_PERSON");
 				CvString strSummary = GetLocalizedText("TXT_KEY_NOTIFICATION_FAITH_GREAT_PERSON_TT");
@@ -44144,7 +44534,7 @@ void CvPlayer::reconnected()
 		connectString << getNameKey();
 
 		CvNotifications* pNotifications = GET_PLAYER(kGame.getActivePlayer()).GetNotifications();
-		if(pNotifications)
+		if(pNotifications && pNotifications->IsRecording())
 		{
 			pNotifications->Add(NOTIFICATION_PLAYER_CONNECTING, connectString.toUTF8(), connectString.toUTF8(), -1, -1, GetID());
 		}
@@ -44304,58 +44694,58 @@ void CvPlayer::GatherPerTurnReplayStats(int iGameTurn)
 	if(isAlive())
 	{
 		//	Production Per Turn
-		setReplayDataValue(getReplayDataSetIndex("REPLAYDATASET_PRODUCTIONPERTURN"), iGameTurn, calculateTotalYield(YIELD_PRODUCTION));
+		setReplayDataValue(getReplayDataSetIndex(REPLAYDATASET_PRODUCTIONPERTURN), iGameTurn, calculateTotalYield(YIELD_PRODUCTION));
 		// 	Gold
-		setReplayDataValue(getReplayDataSetIndex("REPLAYDATASET_TOTALGOLD"), iGameTurn, GetTreasury()->GetGold());
+		setReplayDataValue(getReplayDataSetIndex(REPLAYDATASET_TOTALGOLD), iGameTurn, GetTreasury()->GetGold());
 		// 	Gold per Turn
-		setReplayDataValue(getReplayDataSetIndex("REPLAYDATASET_GOLDPERTURN"), iGameTurn, calculateTotalYield(YIELD_GOLD));
+		setReplayDataValue(getReplayDataSetIndex(REPLAYDATASET_GOLDPERTURN), iGameTurn, calculateTotalYield(YIELD_GOLD));
 		// 	Num Cities
-		setReplayDataValue(getReplayDataSetIndex("REPLAYDATASET_CITYCOUNT"), iGameTurn, getNumCities());
+		setReplayDataValue(getReplayDataSetIndex(REPLAYDATASET_CITYCOUNT), iGameTurn, getNumCities());
 
 		//	Number of Techs known
 		CvTeam& team = GET_TEAM(getTeam());
-		setReplayDataValue(getReplayDataSetIndex("REPLAYDATASET_TECHSKNOWN"), iGameTurn, team.GetTeamTechs()->GetNumTechsKnown());
+		setReplayDataValue(getReplayDataSetIndex(REPLAYDATASET_TECHSKNOWN), iGameTurn, team.GetTeamTechs()->GetNumTechsKnown());
 
 		// 	Science per Turn
-		setReplayDataValue(getReplayDataSetIndex("REPLAYDATASET_SCIENCEPERTURN"), iGameTurn, calculateTotalYield(YIELD_SCIENCE));
+		setReplayDataValue(getReplayDataSetIndex(REPLAYDATASET_SCIENCEPERTURN), iGameTurn, calculateTotalYield(YIELD_SCIENCE));
 		// antonjs: This data is also used to calculate Great Scientist and Research Agreement beaker bonuses. If replay data changes
 		// or is disabled, CvPlayer::GetScienceYieldFromPreviousTurns must also change.
 
 		// 	Total Culture
-		setReplayDataValue(getReplayDataSetIndex("REPLAYDATASET_TOTALCULTURE"), iGameTurn, getJONSCulture());
+		setReplayDataValue(getReplayDataSetIndex(REPLAYDATASET_TOTALCULTURE), iGameTurn, getJONSCulture());
 
 		// 	Culture per turn
-		setReplayDataValue(getReplayDataSetIndex("REPLAYDATASET_CULTUREPERTURN"), iGameTurn, GetTotalJONSCulturePerTurn());
+		setReplayDataValue(getReplayDataSetIndex(REPLAYDATASET_CULTUREPERTURN), iGameTurn, GetTotalJONSCulturePerTurn());
 		
 #if defined(MOD_BALANCE_CORE)
-		setReplayDataValue(getReplayDataSetIndex("REPLAYDATASET_TOURISMPERTURN"), iGameTurn, GetCulture()->GetTourism());
+		setReplayDataValue(getReplayDataSetIndex(REPLAYDATASET_TOURISMPERTURN), iGameTurn, GetCulture()->GetTourism());
 #endif
 
 		// 	Happiness
-		setReplayDataValue(getReplayDataSetIndex("REPLAYDATASET_EXCESSHAPINESS"), iGameTurn, GetExcessHappiness());
-		setReplayDataValue(getReplayDataSetIndex("REPLAYDATASET_HAPPINESS"), iGameTurn, GetHappiness());
-		setReplayDataValue(getReplayDataSetIndex("REPLAYDATASET_UNHAPPINESS"), iGameTurn, GetUnhappiness());
+		setReplayDataValue(getReplayDataSetIndex(REPLAYDATASET_EXCESSHAPINESS), iGameTurn, GetExcessHappiness());
+		setReplayDataValue(getReplayDataSetIndex(REPLAYDATASET_HAPPINESS), iGameTurn, GetHappiness());
+		setReplayDataValue(getReplayDataSetIndex(REPLAYDATASET_UNHAPPINESS), iGameTurn, GetUnhappiness());
 
 		// 	Golden Age turns
-		setReplayDataValue(getReplayDataSetIndex("REPLAYDATASET_GOLDENAGETURNS"), iGameTurn, getGoldenAgeTurns());
+		setReplayDataValue(getReplayDataSetIndex(REPLAYDATASET_GOLDENAGETURNS), iGameTurn, getGoldenAgeTurns());
 
 		// 	Population
-		setReplayDataValue(getReplayDataSetIndex("REPLAYDATASET_POPULATION"), iGameTurn, getTotalPopulation());
+		setReplayDataValue(getReplayDataSetIndex(REPLAYDATASET_POPULATION), iGameTurn, getTotalPopulation());
 
 		// 	Food Per Turn
-		setReplayDataValue(getReplayDataSetIndex("REPLAYDATASET_FOODPERTURN"), iGameTurn, calculateTotalYield(YIELD_FOOD));
+		setReplayDataValue(getReplayDataSetIndex(REPLAYDATASET_FOODPERTURN), iGameTurn, calculateTotalYield(YIELD_FOOD));
 
 		//	Total Land
-		setReplayDataValue(getReplayDataSetIndex("REPLAYDATASET_TOTALLAND"), iGameTurn, getTotalLand());
+		setReplayDataValue(getReplayDataSetIndex(REPLAYDATASET_TOTALLAND), iGameTurn, getTotalLand());
 
 		CvTreasury* pkTreasury = GetTreasury();
-		setReplayDataValue(getReplayDataSetIndex("REPLAYDATASET_GPTCITYCONNECTIONS"), iGameTurn, pkTreasury->GetCityConnectionGold());
-		setReplayDataValue(getReplayDataSetIndex("REPLAYDATASET_GPTINTERNATIONALTRADE"), iGameTurn, pkTreasury->GetGoldPerTurnFromTradeRoutes());
-		setReplayDataValue(getReplayDataSetIndex("REPLAYDATASET_GPTDEALS"), iGameTurn, pkTreasury->GetGoldPerTurnFromDiplomacy());
-		setReplayDataValue(getReplayDataSetIndex("REPLAYDATASET_UNITMAINTENANCE"), iGameTurn, pkTreasury->GetExpensePerTurnUnitMaintenance());
-		setReplayDataValue(getReplayDataSetIndex("REPLAYDATASET_BUILDINGMAINTENANCE"), iGameTurn, pkTreasury->GetBuildingGoldMaintenance());
-		setReplayDataValue(getReplayDataSetIndex("REPLAYDATASET_IMPROVEMENTMAINTENANCE"), iGameTurn, pkTreasury->GetImprovementGoldMaintenance());
-		setReplayDataValue(getReplayDataSetIndex("REPLAYDATASET_NUMBEROFPOLICIES"), iGameTurn, GetPlayerPolicies()->GetNumPoliciesOwned());
+		setReplayDataValue(getReplayDataSetIndex(REPLAYDATASET_GPTCITYCONNECTIONS), iGameTurn, pkTreasury->GetCityConnectionGold());
+		setReplayDataValue(getReplayDataSetIndex(REPLAYDATASET_GPTINTERNATIONALTRADE), iGameTurn, pkTreasury->GetGoldPerTurnFromTradeRoutes());
+		setReplayDataValue(getReplayDataSetIndex(REPLAYDATASET_GPTDEALS), iGameTurn, pkTreasury->GetGoldPerTurnFromDiplomacy());
+		setReplayDataValue(getReplayDataSetIndex(REPLAYDATASET_UNITMAINTENANCE), iGameTurn, pkTreasury->GetExpensePerTurnUnitMaintenance());
+		setReplayDataValue(getReplayDataSetIndex(REPLAYDATASET_BUILDINGMAINTENANCE), iGameTurn, pkTreasury->GetBuildingGoldMaintenance());
+		setReplayDataValue(getReplayDataSetIndex(REPLAYDATASET_IMPROVEMENTMAINTENANCE), iGameTurn, pkTreasury->GetImprovementGoldMaintenance());
+		setReplayDataValue(getReplayDataSetIndex(REPLAYDATASET_NUMBEROFPOLICIES), iGameTurn, GetPlayerPolicies()->GetNumPoliciesOwned());
 
 		// workers
 		int iWorkerCount = 0;
@@ -44368,7 +44758,7 @@ void CvPlayer::GatherPerTurnReplayStats(int iGameTurn)
 				iWorkerCount++;
 			}
 		}
-		setReplayDataValue(getReplayDataSetIndex("REPLAYDATASET_NUMBEROFWORKERS"), iGameTurn, iWorkerCount);
+		setReplayDataValue(getReplayDataSetIndex(REPLAYDATASET_NUMBEROFWORKERS), iGameTurn, iWorkerCount);
 
 
 		// go through all the plots the player has under their control
@@ -44408,12 +44798,12 @@ void CvPlayer::GatherPerTurnReplayStats(int iGameTurn)
 			}
 		}
 
-		setReplayDataValue(getReplayDataSetIndex("REPLAYDATASET_IMPROVEDTILES"), iGameTurn, iImprovedTiles);
-		setReplayDataValue(getReplayDataSetIndex("REPLAYDATASET_WORKEDTILES"), iGameTurn, iWorkedTiles);
-		setReplayDataValue(getReplayDataSetIndex("REPLAYDATASET_NUMBEROFWORKERS"), iGameTurn, iWorkerCount);
+		setReplayDataValue(getReplayDataSetIndex(REPLAYDATASET_IMPROVEDTILES), iGameTurn, iImprovedTiles);
+		setReplayDataValue(getReplayDataSetIndex(REPLAYDATASET_WORKEDTILES), iGameTurn, iWorkedTiles);
+		setReplayDataValue(getReplayDataSetIndex(REPLAYDATASET_NUMBEROFWORKERS), iGameTurn, iWorkerCount);
 
 
-		setReplayDataValue(getReplayDataSetIndex("REPLAYDATASET_MILITARYMIGHT"), iGameTurn, GetMilitaryMight());
+		setReplayDataValue(getReplayDataSetIndex(REPLAYDATASET_MILITARYMIGHT), iGameTurn, GetMilitaryMight());
 	}
 }
 
@@ -83,6 +83,43 @@ private:
 
 public:
 	typedef std::map<unsigned int, int> TurnData;
+	//dense per-turn replay values, indexed by game turn
+	typedef std::vector<int> TurnValues;
+	//REPLAY_DATA_NO_VALUE marks turns without data and is reserved, setReplayDataValue stores INT_MIN as INT_MIN+1
+	enum { REPLAY_DATA_NO_VALUE = INT_MIN, REPLAY_DATA_MAX_TURN = 10000 };
+	//replay data sets recorded by the game itself, their indices are looked up once per player
+	enum BuiltInReplayDataSetTypes
+	{
+		REPLAYDATASET_SCORE,
+		REPLAYDATASET_PRODUCTIONPERTURN,
+		REPLAYDATASET_TOTALGOLD,
+		REPLAYDATASET_GOLDPERTURN,
+		REPLAYDATASET_CITYCOUNT,
+		REPLAYDATASET_TECHSKNOWN,
+		REPLAYDATASET_SCIENCEPERTURN,
+		REPLAYDATASET_TOTALCULTURE,
+		REPLAYDATASET_CULTUREPERTURN,
+		REPLAYDATASET_TOURISMPERTURN,
+		REPLAYDATASET_EXCESSHAPINESS,
+		REPLAYDATASET_HAPPINESS,
+		REPLAYDATASET_UNHAPPINESS,
+		REPLAYDATASET_GOLDENAGETURNS,
+		REPLAYDATASET_POPULATION,
+		REPLAYDATASET_FOODPERTURN,
+		REPLAYDATASET_TOTALLAND,
+		REPLAYDATASET_GPTCITYCONNECTIONS,
+		REPLAYDATASET_GPTINTERNATIONALTRADE,
+		REPLAYDATASET_GPTDEALS,
+		REPLAYDATASET_UNITMAINTENANCE,
+		REPLAYDATASET_BUILDINGMAINTENANCE,
+		REPLAYDATASET_IMPROVEMENTMAINTENANCE,
+		REPLAYDATASET_NUMBEROFPOLICIES,
+		REPLAYDATASET_NUMBEROFWORKERS,
+		REPLAYDATASET_IMPROVEDTILES,
+		REPLAYDATASET_WORKEDTILES,
+		REPLAYDATASET_MILITARYMIGHT,
+		NUM_BUILTIN_REPLAYDATASETS
+	};
 
 	CvPlayer();
 	virtual ~CvPlayer();
@@ -368,6 +405,9 @@ public:
 	bool isProductionMaxedUnitClass(UnitClassTypes eUnitClass) const;
 	bool isProductionMaxedBuildingClass(BuildingClassTypes eBuildingClass, bool bAcquireCity = false) const;
 	bool isProductionMaxedProject(ProjectTypes eProject) const;
+
+	const std::vector<UnitTypes>& GetProductionUnitCandidates();
+	const std::vector<BuildingTypes>& GetProductionBuildingCandidates();
 	int getProductionNeeded(UnitTypes eUnit) const;
 	int getProductionNeeded(BuildingTypes eBuilding) const;
 	int getProductionNeeded(ProjectTypes eProject) const;
@@ -625,6 +665,8 @@ public:
 	void SetUnhappiness(int iNewValue);
 	int GetUnhappiness() const;
 	void CalculateNetHappiness();
+	void BeginHappinessUpdateBatch();
+	void EndHappinessUpdateBatch();
 
 #if defined(MOD_BALANCE_CORE_HAPPINESS_NATIONAL)
 	//LUA Functions
@@ -1230,6 +1272,9 @@ public:
 	int GetInfluenceSpreadModifier() const;
 	void ChangeInfluenceSpreadModifier(int iChange);
 
+	bool HasInfluenceNullifyingBuilding() const;
+	void UpdateNumInfluenceNullifyingBuildings();
+
 	int GetExtraVotesPerDiplomat() const;
 	void ChangeExtraVotesPerDiplomat(int iChange);
 
@@ -2252,9 +2297,10 @@ public:
 	unsigned int getNumReplayDataSets() const;
 	const char* getReplayDataSetName(unsigned int uiDataSet) const;
 	unsigned int getReplayDataSetIndex(const char* szDataSetName);
+	unsigned int getReplayDataSetIndex(BuiltInReplayDataSetTypes eDataSet);
 	int getReplayDataValue(unsigned int uiDataSet, unsigned int uiTurn) const;
 	void setReplayDataValue(unsigned int uiDataSet, unsigned int uiTurn, int iValue);
-	TurnData getReplayDataHistory(unsigned int uiDataSet) const;
+	const TurnValues& getReplayDataHistory(unsigned int uiDataSet) const;
 
 	// Arbitrary Script Data
 	std::string getScriptData() const;
@@ -2688,6 +2734,8 @@ public:
 #endif
 
 protected:
+	void UpdateProductionCandidates();
+
 	class ConqueredByBoolField
 	{
 	public:
@@ -2770,6 +2818,8 @@ protected:
 #if defined(MOD_BALANCE_CORE_HAPPINESS)
 	FAutoVariable<int, CvPlayer> m_iUnhappiness;
 	FAutoVariable<int, CvPlayer> m_iHappinessTotal;
+	int m_iHappinessUpdateBatchDepth; // not serialized, only non-zero inside a batch
+	bool m_bHappinessUpdatePending;
 	FAutoVariable<int, CvPlayer> m_iChangePovertyUnhappinessGlobal;
 	FAutoVariable<int, CvPlayer> m_iChangeDefenseUnhappinessGlobal;
 	FAutoVariable<int, CvPlayer> m_iChangeUnculturedUnhappinessGlobal;
@@ -3002,6 +3052,7 @@ protected:
 	FAutoVariable<int, CvPlayer> m_iPolicyCostBuildingModifier;
 	FAutoVariable<int, CvPlayer> m_iPolicyCostMinorCivModifier;
 	FAutoVariable<int, CvPlayer> m_iInfluenceSpreadModifier;
+	int m_iNumInfluenceNullifyingBuildings; // derived from the city buildings, not serialized
 	FAutoVariable<int, CvPlayer> m_iExtraVotesPerDiplomat;
 	FAutoVariable<int, CvPlayer> m_iNumNukeUnits;
 	FAutoVariable<int, CvPlayer> m_iNumOutsideUnits;
@@ -3343,7 +3394,8 @@ protected:
 	std::vector< std::pair<UnitClassTypes, int> > m_aUnitExtraCosts;
 
 	std::vector<CvString> m_ReplayDataSets;
-	std::vector<TurnData> m_ReplayDataSetValues;
+	std::vector<TurnValues> m_ReplayDataSetValues;
+	unsigned int m_auiBuiltInReplayDataSets[NUM_BUILTIN_REPLAYDATASETS]; //not serialized, NO_REPLAYDATASET until first use
 
 	void doResearch();
 	void doWarnings();
@@ -3427,6 +3479,11 @@ protected:
 
 	CvPlotsVector m_aiPlots;
 
+	// units and buildings which pass the canTrain/canConstruct gates that are fixed for the whole game
+	std::vector<UnitTypes> m_aeProductionUnitCandidates;
+	std::vector<BuildingTypes> m_aeProductionBuildingCandidates;
+	bool m_bProductionCandidatesValid;
+
 	// Treasury
 	CvTreasury* m_pTreasury;
 
@@ -276,9 +276,7 @@ void CvPlayerAI::AI_unitUpdate()
 		return;
 	}
 
-	//do this only after updating the danger plots (happens in CvPlayer::doTurnPostDiplomacy)
-	//despite the name, the tactical map is used by homeland AI as well.
-	GetTacticalAI()->GetTacticalAnalysisMap()->Refresh();
+	AI_updateUnitAnalysis();
 
 	if(isHuman())
 	{
@@ -297,6 +295,19 @@ void CvPlayerAI::AI_unitUpdate()
 	}
 }
 
+//	---------------------------------------------------------------------------
+/// Analysis phase before any unit moves. Only reads the world state, the move phase afterwards consumes the results.
+void CvPlayerAI::AI_updateUnitAnalysis()
+{
+	//danger is otherwise rebuilt lazily by whichever unit asks first, in the middle of the move phase
+	if(m_pDangerPlots->IsDirty())
+		UpdateDangerPlots();
+
+	//do this only after updating the danger plots (happens in CvPlayer::doTurnPostDiplomacy)
+	//despite the name, the tactical map is used by homeland AI as well.
+	GetTacticalAI()->GetTacticalAnalysisMap()->Refresh();
+}
+
 #if defined(MOD_BALANCE_CORE)
 void CvPlayerAI::AI_conquerCity(CvCity* pCity, PlayerTypes eOldOwner, bool bGift, bool bAllowRaze)
 #else
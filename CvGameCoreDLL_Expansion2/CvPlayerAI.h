@@ -42,6 +42,7 @@ public:
 	void AI_doTurnUnitsPost();
 
 	void AI_unitUpdate();
+	void AI_updateUnitAnalysis();
 #if defined(MOD_BALANCE_CORE)
 	void AI_conquerCity(CvCity* pCity, PlayerTypes eOldOwner, bool bGift, bool bAllowRaze);
 #else
@@ -6001,6 +6001,7 @@ void CvPlot::setOwner(PlayerTypes eNewValue, int iAcquiringCityID, bool bCheckUn
 	{
 		PlayerTypes eOldOwner = getOwner();
 
+		GC.GetStepFinder().ClearPathCache();
 		GC.getGame().addReplayMessage(REPLAY_MESSAGE_PLOT_OWNER_CHANGE, eNewValue, "", getX(), getY());
 
 		pOldCity = getPlotCity();
@@ -6780,6 +6781,7 @@ void CvPlot::setPlotType(PlotTypes eNewValue, bool bRecalculate, bool bRebuildGr
 #if defined(MOD_BALANCE_CORE)
 		updateImpassable();
 #endif
+		GC.GetStepFinder().ClearPathCache();
 
 		updateSeeFromSight(true,bRecalculate);
 
@@ -7029,6 +7031,7 @@ void CvPlot::setTerrainType(TerrainTypes eNewValue, bool bRecalculate, bool bReb
 
 		updateYield();
 		updateImpassable();
+		GC.GetStepFinder().ClearPathCache();
 
 #if defined(MOD_BALANCE_CORE)
 		CvCity* pWorkingCity = getWorkingCity();
@@ -7133,6 +7136,7 @@ void CvPlot::setFeatureType(FeatureTypes eNewValue, int iVariety)
 #endif
 		updateYield();
 		updateImpassable();
+		GC.GetStepFinder().ClearPathCache();
 #if defined(MOD_BALANCE_CORE)
 		if(pWorkingCity != NULL)
 		{
@@ -7759,6 +7763,7 @@ void CvPlot::setImprovementType(ImprovementTypes eNewValue, PlayerTypes eBuilder
 		}
 
 		m_eImprovementType = eNewValue;
+		GC.getMap().PlotImprovementChanged(GetPlotIndex(), eOldImprovement, eNewValue);
 #if defined(MOD_GLOBAL_STACKING_RULES)
 		calculateAdditionalUnitsFromImprovement();
 #endif
@@ -8650,6 +8655,8 @@ void CvPlot::setRouteType(RouteTypes eNewValue)
 
 	if(eOldRoute != eNewValue || (eOldRoute == eNewValue && IsRoutePillaged()))
 	{
+		GC.GetStepFinder().ClearPathCache();
+
 		// Remove old effects
 		if(eOldRoute != NO_ROUTE && !isCity())
 		{
@@ -8771,6 +8778,8 @@ void CvPlot::SetRoutePillaged(bool bPillaged)
 {
 	if(m_bRoutePillaged != bPillaged)
 	{
+		GC.GetStepFinder().ClearPathCache();
+
 		for(int iI = 0; iI < MAX_TEAMS; ++iI)
 		{
 #ifdef AUI_PLOT_OBSERVER_SEE_ALL_PLOTS
@@ -9052,6 +9061,8 @@ void CvPlot::setPlotCity(CvCity* pNewValue)
 
 	if(getPlotCity() != pNewValue)
 	{
+		GC.GetStepFinder().ClearPathCache();
+
 		if(isCity())
 		{
 			// Is a route is here?  If so, we may now need to pay maintenance for it.  Yes, yes, I know, we're removing a city
@@ -14384,6 +14395,7 @@ bool CvPlot::IsNearEnemyCitadel(PlayerTypes ePlayer, int* piCitadelDamage) const
 }
 
 //	---------------------------------------------------------------------------
+//runs per plot during bulk updates, so the callers drop the step path cache once afterwards
 void CvPlot::updateImpassable(TeamTypes eTeam)
 {
 	const TerrainTypes eTerrain = getTerrainType();
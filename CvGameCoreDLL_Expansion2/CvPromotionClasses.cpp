@@ -2556,6 +2556,37 @@ CvPromotionEntry* CvPromotionXMLEntries::GetEntry(int index)
 #endif
 }
 
+/// Rebuild the lookup tables derived from the promotion entries
+void CvPromotionXMLEntries::UpdateDerivedData()
+{
+	for(int iYield = 0; iYield < NUM_YIELD_TYPES; iYield++)
+	{
+		m_aYieldModifierPromotions[iYield].clear();
+	}
+
+	for(uint iPromotion = 0; iPromotion < m_paPromotionEntries.size(); iPromotion++)
+	{
+		const CvPromotionEntry* pkEntry = m_paPromotionEntries[iPromotion];
+		if(pkEntry == NULL)
+			continue;
+
+		for(int iYield = 0; iYield < NUM_YIELD_TYPES; iYield++)
+		{
+			if(pkEntry->GetYieldModifier(iYield) > 0)
+			{
+				m_aYieldModifierPromotions[iYield].push_back((PromotionTypes)iPromotion);
+			}
+		}
+	}
+}
+
+/// Promotions which give a city yield modifier for the given yield, in promotion order
+const std::vector<PromotionTypes>& CvPromotionXMLEntries::GetPromotionsWithYieldModifier(YieldTypes eYield) const
+{
+	CvAssertMsg(eYield >= 0 && eYield < NUM_YIELD_TYPES, "eYield out of range");
+	return m_aYieldModifierPromotions[eYield];
+}
+
 /// Clear promotion entries
 void CvPromotionXMLEntries::DeleteArray()
 {
@@ -2565,6 +2596,11 @@ void CvPromotionXMLEntries::DeleteArray()
 	}
 
 	m_paPromotionEntries.clear();
+
+	for(int iYield = 0; iYield < NUM_YIELD_TYPES; iYield++)
+	{
+		m_aYieldModifierPromotions[iYield].clear();
+	}
 }
 
 //=====================================
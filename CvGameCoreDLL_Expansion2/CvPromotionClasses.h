@@ -584,11 +584,16 @@ public:
 	int GetNumPromotions();
 	_Ret_maybenull_ CvPromotionEntry* GetEntry(int index);
 
+	// Lookup tables derived from the entries, rebuilt after the entries are loaded
+	void UpdateDerivedData();
+	const std::vector<PromotionTypes>& GetPromotionsWithYieldModifier(YieldTypes eYield) const;
+
 	// Binary cache functions
 	void DeleteArray();
 
 private:
 	std::vector<CvPromotionEntry*> m_paPromotionEntries;
+	std::vector<PromotionTypes> m_aYieldModifierPromotions[NUM_YIELD_TYPES];
 };
 
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -85,7 +85,7 @@ void CvRandom::reset(unsigned long long ullSeed)
 
 unsigned long CvRandom::get(unsigned long ulNum, const char* pszLog)
 {
-	if(!gDLL->IsGameCoreThread() && gDLL->IsGameCoreExecuting() && m_bSynchronous)
+	if(m_bSynchronous && !gDLL->IsGameCoreThread() && gDLL->IsGameCoreExecuting())
 	{
 		OutputDebugString("Warning: GUI is accessing the synchronous random number generator while the game core is running.");
 	}
@@ -99,36 +99,67 @@ unsigned long CvRandom::get(unsigned long ulNum, const char* pszLog)
 	unsigned long long ullNewSeed = ((RANDOM_A * m_ullRandomSeed) + RANDOM_C);
 	unsigned long ul = ((unsigned long)((((ullNewSeed >> RANDOM_SHIFT) & MAX_UNSIGNED_INT) * (ulNum)) / (MAX_UNSIGNED_INT + 1LL)));
 
-	if(GC.getLogging())
+	//keep the formatting out of the hot path, it is only paid for when rand logging is on
+	if(GC.getLogging() && GC.getRandLogging() > 0)
 	{
-		int iRandLogging = GC.getRandLogging();
-		if(iRandLogging > 0 && (m_bSynchronous || (iRandLogging & RAND_LOGGING_ASYNCHRONOUS_FLAG) != 0))
+		logCall(ulNum, ul, ullNewSeed, pszLog);
+	}
+
+	m_ullRandomSeed = ullNewSeed;
+	return ul;
+}
+
+void CvRandom::logCall(unsigned long ulNum, unsigned long ulResult, unsigned long long ullNewSeed, const char* pszLog) const
+{
+	int iRandLogging = GC.getRandLogging();
+	if(m_bSynchronous || (iRandLogging & RAND_LOGGING_ASYNCHRONOUS_FLAG) != 0)
+	{
+		CvGame& kGame = GC.getGame();
+		if(kGame.getTurnSlice() > 0 || ((iRandLogging & RAND_LOGGING_PREGAME_FLAG) != 0))
 		{
-			CvGame& kGame = GC.getGame();
-			if(kGame.getTurnSlice() > 0 || ((iRandLogging & RAND_LOGGING_PREGAME_FLAG) != 0))
+			FILogFile* pLog = LOGFILEMGR.GetLog("RandCalls.csv", FILogFile::kDontTimeStamp);
+			if(pLog)
 			{
-				FILogFile* pLog = LOGFILEMGR.GetLog("RandCalls.csv", FILogFile::kDontTimeStamp);
-				if(pLog)
-				{
-					char szOut[1024] = {0};
-					sprintf_s(szOut, "%s, %d, max %u, res %u, seed %I64u, cc %d, rc %d, %s, %s\n", m_name.c_str(), kGame.getGameTurn(), 
-						ulNum, ul, ullNewSeed, m_ulCallCount, m_ulResetCount, m_bSynchronous ? "sync" : "async", (pszLog != NULL) ? pszLog : "Unknown");
-					pLog->Msg(szOut);
+				char szOut[1024] = {0};
+				sprintf_s(szOut, "%s, %d, max %u, res %u, seed %I64u, cc %d, rc %d, %s, %s\n", m_name.c_str(), kGame.getGameTurn(), 
+					ulNum, ulResult, ullNewSeed, m_ulCallCount, m_ulResetCount, m_bSynchronous ? "sync" : "async", (pszLog != NULL) ? pszLog : "Unknown");
+				pLog->Msg(szOut);
 
 #if defined(MOD_CORE_DEBUGGING)
-					if(MOD_CORE_DEBUGGING)
-					{
-						gStackWalker.SetLog(pLog);
-						gStackWalker.ShowCallstack();
-					}
-#endif
+				if(MOD_CORE_DEBUGGING)
+				{
+					gStackWalker.SetLog(pLog);
+					gStackWalker.ShowCallstack();
 				}
+#endif
 			}
 		}
 	}
+}
 
-	m_ullRandomSeed = ullNewSeed;
-	return ul;
+// splitmix64 finalizer, every input bit affects every output bit
+static unsigned long long MixRandomKey(unsigned long long ullValue)
+{
+	ullValue = (ullValue ^ (ullValue >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	ullValue = (ullValue ^ (ullValue >> 27)) * 0x94d049bb133111ebULL;
+	return ullValue ^ (ullValue >> 31);
+}
+
+unsigned long CvRandom::getKeyed(unsigned long ulNum, unsigned long long ullSeed, unsigned long ulKey1, unsigned long ulKey2, unsigned long ulKey3, unsigned long ulKey4)
+{
+	//catch trivial cases
+	if (ulNum < 2)
+		return 0;
+
+	const unsigned long long ullGolden = 0x9e3779b97f4a7c15ULL;
+	unsigned long long ullValue = MixRandomKey(ullSeed + ullGolden);
+	ullValue = MixRandomKey(ullValue + ulKey1 + ullGolden);
+	ullValue = MixRandomKey(ullValue + ulKey2 + ullGolden);
+	ullValue = MixRandomKey(ullValue + ulKey3 + ullGolden);
+	ullValue = MixRandomKey(ullValue + ulKey4 + ullGolden);
+
+	//same scaling as get()
+	return ((unsigned long)(((ullValue >> 32) * (ulNum)) / (MAX_UNSIGNED_INT + 1LL)));
 }
 
 float CvRandom::getFloat()
@@ -29,6 +29,10 @@ public:
 
 	float getFloat();
 
+	//  Counter based generator without state, returns value from 0 to num-1 inclusive.
+	//  The result depends only on the seed and the keys, never on the order of other calls.
+	static unsigned long getKeyed(unsigned long ulNum, unsigned long long ullSeed, unsigned long ulKey1, unsigned long ulKey2 = 0, unsigned long ulKey3 = 0, unsigned long ulKey4 = 0);
+
 	void reseed(unsigned long long ulNewValue);
 	unsigned long long getSeed() const;
 	unsigned long getCallCount() const;
@@ -59,6 +63,8 @@ private:
 	CvRandom(const CvRandom& source);
 	CvRandom();
 	CvRandom operator=(const CvRandom&);
+
+	void logCall(unsigned long ulNum, unsigned long ulResult, unsigned long long ullNewSeed, const char* pszLog) const;
 };
 
 FDataStream& operator<<(FDataStream& saveTo, const CvRandom& readFrom);
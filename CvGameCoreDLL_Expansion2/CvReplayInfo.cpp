@@ -175,12 +175,13 @@ void CvReplayInfo::createInfo()
 					uiDataSet = m_dataSetMap.size() - 1;
 				}
 
-				CvPlayer::TurnData playerData = player.getReplayDataHistory(uiPlayerDataSet);
+				const CvPlayer::TurnValues& playerData = player.getReplayDataHistory(uiPlayerDataSet);
 				TurnData turnData;
 
-				for(CvPlayer::TurnData::iterator it = playerData.begin(); it != playerData.end(); ++it)
+				for(unsigned int uiTurn = 0; uiTurn < playerData.size(); ++uiTurn)
 				{
-					turnData[(*it).first - m_iInitialTurn] = (*it).second;
+					if(playerData[uiTurn] != CvPlayer::REPLAY_DATA_NO_VALUE)
+						turnData[uiTurn - m_iInitialTurn] = playerData[uiTurn];
 				}
 
 				dataSet[uiDataSet] = turnData;
@@ -21,6 +21,7 @@ CvStartPositioner::CvStartPositioner(void)
 {
 	m_iRequiredSeparation = 0;
 	m_iBestFoundValueOnMap = 0;
+	m_iFertilityPrefixSumsArea = -1;
 }
 
 /// Destructor
@@ -337,6 +338,10 @@ void CvStartPositioner::ComputeTileFertilityValues()
 	int iI;
 	int uiFertility;
 
+	// Fertility is about to change, so any prefix sums we built are stale
+	m_aiFertilityPrefixSums.clear();
+	m_iFertilityPrefixSumsArea = -1;
+
 	// Set all area fertilities to 0
 	for(pLoopArea = GC.getMap().firstArea(&iLoop); pLoopArea != NULL; pLoopArea = GC.getMap().nextArea(&iLoop))
 	{
@@ -597,6 +602,25 @@ int CvStartPositioner::ComputeRowFertility(int iAreaID, int xMin, int xMax, int
 {
 	int rtnValue = 0;
 
+	const CvMap& kMap = GC.getMap();
+	const int iWidth = kMap.getGridWidth();
+	if(xMin >= 0 && xMax < iWidth && yMin >= 0 && yMax < kMap.getGridHeight())
+	{
+		if(xMin > xMax || yMin > yMax)
+			return 0;
+
+		// Regions are chopped one area at a time, so the table only needs rebuilding when the area changes
+		if(iAreaID != m_iFertilityPrefixSumsArea)
+			BuildFertilityPrefixSums(iAreaID);
+
+		const int iStride = iWidth + 1;
+		return m_aiFertilityPrefixSums[(yMax + 1) * iStride + (xMax + 1)]
+		       - m_aiFertilityPrefixSums[yMin * iStride + (xMax + 1)]
+		       - m_aiFertilityPrefixSums[(yMax + 1) * iStride + xMin]
+		       + m_aiFertilityPrefixSums[yMin * iStride + xMin];
+	}
+
+	// Rectangle leaves the grid (wrapped coordinates), walk it plot by plot
 	for(int iRow = yMin; iRow <= yMax; iRow++)
 	{
 		for(int iCol = xMin; iCol <= xMax; iCol++)
@@ -618,6 +642,37 @@ int CvStartPositioner::ComputeRowFertility(int iAreaID, int xMin, int xMax, int
 	return rtnValue;
 }
 
+/// Builds the summed-area table of positive fertility for plots in one area
+void CvStartPositioner::BuildFertilityPrefixSums(int iAreaID)
+{
+	const CvMap& kMap = GC.getMap();
+	const int iWidth = kMap.getGridWidth();
+	const int iHeight = kMap.getGridHeight();
+	const int iStride = iWidth + 1;
+
+	// Entry (x, y) holds the total for all plots with column < x and row < y
+	m_aiFertilityPrefixSums.assign(iStride * (iHeight + 1), 0);
+	m_iFertilityPrefixSumsArea = iAreaID;
+
+	for(int iRow = 0; iRow < iHeight; iRow++)
+	{
+		int iRowSum = 0;
+		for(int iCol = 0; iCol < iWidth; iCol++)
+		{
+			CvPlot* pPlot = kMap.plotUnchecked(iCol, iRow);
+			if(pPlot && pPlot->getArea() == iAreaID)
+			{
+				// Retrieve from player 0's found value slot (see ComputeTileFertilityValues)
+				int iValue = pPlot->getFoundValue((PlayerTypes)0);
+				if(iValue > 0)
+					iRowSum += iValue;
+			}
+
+			m_aiFertilityPrefixSums[(iRow + 1) * iStride + (iCol + 1)] = m_aiFertilityPrefixSums[iRow * iStride + (iCol + 1)] + iRowSum;
+		}
+	}
+}
+
 /// Pick a start position for a civ within a specific region
 bool CvStartPositioner::AddCivToRegion(int iPlayerIndex, CvStartRegion region, bool bRelaxFoodReq)
 {
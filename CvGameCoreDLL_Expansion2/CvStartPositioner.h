@@ -200,6 +200,7 @@ private:
 	void ChopIntoTwoRegions(bool bTaller, CvStartRegion* region, CvStartRegion* secondRegion, int iChopPercent);
 	void ChopIntoThreeRegions(bool bTaller, CvStartRegion* region, CvStartRegion* secondRegion, CvStartRegion* thirdRegion);
 	int ComputeRowFertility(int iAreaID, int xMin, int xMax, int yMin, int yMax);
+	void BuildFertilityPrefixSums(int iAreaID);
 	bool AddCivToRegion(int iPlayerIndex, CvStartRegion region, bool bRelaxFoodReq);
 	bool TooCloseToAnotherCiv(CvPlot* pPlot);
 	bool MeetsFoodRequirement(CvPlot* pPlot, PlayerTypes ePlayer, int iFoodRequirement);
@@ -218,6 +219,10 @@ private:
 	vector<CvPlayerStartRank>::iterator m_PlayerOrderIter;
 	int m_iRequiredSeparation;
 	int m_iBestFoundValueOnMap;
+
+	// Summed-area table of plot fertility for one area, so chopping a region doesn't rescan its rows
+	vector<int> m_aiFertilityPrefixSums;
+	int m_iFertilityPrefixSumsArea;
 };
 
 #endif //CIV5_START_POSITIONER_H
\ No newline at end of file
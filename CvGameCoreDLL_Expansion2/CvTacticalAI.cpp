@@ -1553,7 +1553,7 @@ void CvTacticalAI::EstablishBarbarianPriorities()
 		{
 			// Finally, add a random die roll to each priority
 #if defined(MOD_CORE_REDUCE_RANDOMNESS)
-			iPriority += GC.getGame().getSmallFakeRandNum(GC.getAI_TACTICAL_MOVE_PRIORITY_RANDOMNESS(),iI);
+			iPriority += GC.getGame().getKeyedRandNum(GC.getAI_TACTICAL_MOVE_PRIORITY_RANDOMNESS(), RAND_STREAM_MILITARY_AI, m_pPlayer->GetID(), iI);
 #else
 			iPriority += GC.getGame().getJonRandNum(GC.getAI_TACTICAL_MOVE_PRIORITY_RANDOMNESS(), "Tactical AI Move Priority");
 #endif
@@ -9865,7 +9865,7 @@ CvPlot* CvTacticalAI::FindBarbarianExploreTarget(CvUnit* pUnit)
 		if (iValue == 0)
 			iValue = plotDistance(pUnit->getX(), pUnit->getY(), pConsiderPlot->getX(), pConsiderPlot->getY());
 
-		if (iValue > iBestValue || (iValue == iBestValue && GC.getGame().getSmallFakeRandNum(3,*pConsiderPlot)==0))
+		if (iValue > iBestValue || (iValue == iBestValue && GC.getGame().getKeyedRandNum(3, RAND_STREAM_MILITARY_AI, m_pPlayer->GetID(), pConsiderPlot->GetPlotIndex())==0))
 		{
 			pBestMovePlot = pConsiderPlot;
 			iBestValue = iValue;
@@ -10085,7 +10085,7 @@ CvPlot* CvTacticalAI::FindNearbyTarget(CvUnit* pUnit, int iRange, AITacticalTarg
 				continue;
 
 			int iValue = target.GetAuxIntData() / max(1,it->iTurns);
-			if( iValue > iBestValue || (iValue == iBestValue && GC.getGame().getSmallFakeRandNum(3,*pPlot)==0) )
+			if( iValue > iBestValue || (iValue == iBestValue && GC.getGame().getKeyedRandNum(3, RAND_STREAM_MILITARY_AI, m_pPlayer->GetID(), pPlot->GetPlotIndex())==0) )
 			{
 				pBestMovePlot = pPlot;
 				iBestValue = iValue;
@@ -12339,6 +12339,65 @@ int NumAttacksForUnit(int iMovesLeft, int iMaxAttacks)
 	return max(0, min( (iMovesLeft+GC.getMOVE_DENOMINATOR()-1)/GC.getMOVE_DENOMINATOR(), iMaxAttacks ));
 }
 
+//while searching for the best assignments the game state doesn't change, so the outcome of an attack only depends on
+//who attacks from where against which plot. the same combination comes up in many positions, so remember the results
+struct SSimulatedAttackKey
+{
+	int iUnitID;
+	int iFromPlot;
+	int iTargetPlot;
+	int iPrevDamage;
+
+	bool operator<(const SSimulatedAttackKey& rhs) const
+	{
+		if (iUnitID != rhs.iUnitID) return iUnitID < rhs.iUnitID;
+		if (iFromPlot != rhs.iFromPlot) return iFromPlot < rhs.iFromPlot;
+		if (iTargetPlot != rhs.iTargetPlot) return iTargetPlot < rhs.iTargetPlot;
+		return iPrevDamage < rhs.iPrevDamage;
+	}
+};
+
+struct SSimulatedAttackResult
+{
+	int iDamageDealt;
+	int iDamageReceived;
+};
+
+static std::map<SSimulatedAttackKey,SSimulatedAttackResult> g_simulatedAttackCache;
+static bool g_bSimulatedAttackCacheActive = false;
+
+//only valid for the duration of one assignment search
+struct CvSimulatedAttackCacheScope
+{
+	CvSimulatedAttackCacheScope() { g_simulatedAttackCache.clear(); g_bSimulatedAttackCacheActive = true; }
+	~CvSimulatedAttackCacheScope() { g_simulatedAttackCache.clear(); g_bSimulatedAttackCacheActive = false; }
+};
+
+bool LookupSimulatedAttack(const SSimulatedAttackKey& key, int& iDamageDealt, int& iDamageReceived)
+{
+	if (!g_bSimulatedAttackCacheActive)
+		return false;
+
+	std::map<SSimulatedAttackKey,SSimulatedAttackResult>::const_iterator it = g_simulatedAttackCache.find(key);
+	if (it == g_simulatedAttackCache.end())
+		return false;
+
+	iDamageDealt = it->second.iDamageDealt;
+	iDamageReceived = it->second.iDamageReceived;
+	return true;
+}
+
+void StoreSimulatedAttack(const SSimulatedAttackKey& key, int iDamageDealt, int iDamageReceived)
+{
+	if (!g_bSimulatedAttackCacheActive)
+		return;
+
+	SSimulatedAttackResult result;
+	result.iDamageDealt = iDamageDealt;
+	result.iDamageReceived = iDamageReceived;
+	g_simulatedAttackCache[key] = result;
+}
+
 void ScoreAttack(const CvTacticalPlot& tactPlot, CvUnit* pUnit, const CvTacticalPlot& assumedPlot, eAggressionLevel eAggLvl, float fUnitNumberRatio, STacticalAssignment& result)
 {
 	int iDamageDealt = 0;
@@ -12354,10 +12413,20 @@ void ScoreAttack(const CvTacticalPlot& tactPlot, CvUnit* pUnit, const CvTactical
 	bool bFlankModifierOffensive = false;
 	bool bFlankModifierDefensive = false;
 
+	SSimulatedAttackKey attackKey;
+	attackKey.iUnitID = pUnit->GetID();
+	attackKey.iFromPlot = assumedPlot.getPlotIndex();
+	attackKey.iTargetPlot = tactPlot.getPlotIndex();
+	attackKey.iPrevDamage = iPrevDamage;
+
 	if(tactPlot.isEnemyCity()) //a plot can be both a city and a unit - in that case we would attack the city
 	{
 		CvCity* pEnemy = pTestPlot->getPlotCity();
-		iDamageDealt = TacticalAIHelpers::GetSimulatedDamageFromAttackOnCity(pEnemy, pUnit, pUnitPlot, iDamageReceived, true, iPrevDamage);
+		if (!LookupSimulatedAttack(attackKey, iDamageDealt, iDamageReceived))
+		{
+			iDamageDealt = TacticalAIHelpers::GetSimulatedDamageFromAttackOnCity(pEnemy, pUnit, pUnitPlot, iDamageReceived, true, iPrevDamage);
+			StoreSimulatedAttack(attackKey, iDamageDealt, iDamageReceived);
+		}
 		iPrevHitPoints = pEnemy->GetMaxHitPoints() - pEnemy->getDamage() - iPrevDamage;
 
 		//city blockaded? not 100% accurate, but anyway
@@ -12377,7 +12446,11 @@ void ScoreAttack(const CvTacticalPlot& tactPlot, CvUnit* pUnit, const CvTactical
 			result.iScore = -1;
 			return;
 		}
-		iDamageDealt = TacticalAIHelpers::GetSimulatedDamageFromAttackOnUnit(pEnemy, pUnit, pTestPlot, pUnitPlot, iDamageReceived, true, iPrevDamage);
+		if (!LookupSimulatedAttack(attackKey, iDamageDealt, iDamageReceived))
+		{
+			iDamageDealt = TacticalAIHelpers::GetSimulatedDamageFromAttackOnUnit(pEnemy, pUnit, pTestPlot, pUnitPlot, iDamageReceived, true, iPrevDamage);
+			StoreSimulatedAttack(attackKey, iDamageDealt, iDamageReceived);
+		}
 		iPrevHitPoints = pEnemy->GetCurrHitPoints() - iPrevDamage;
 
 		bFlankModifierDefensive = pEnemy->GetFlankAttackModifier() > 0;
@@ -13917,6 +13990,9 @@ bool TacticalAIHelpers::FindBestAssignmentsForUnits(const vector<CvUnit*>& vUnit
 	cvStopWatch timer("tactical move checker",NULL,0,true);
 	timer.StartPerfTest();
 
+	//attack outcomes are shared between all positions we look at
+	CvSimulatedAttackCacheScope attackCacheScope;
+
 	//set up the initial position
 	g_siTacticalPositionCount = 0;
 	CvTacticalPosition* initialPosition = new CvTacticalPosition(ePlayer,eAggLvl,pTarget);
@@ -31,6 +31,7 @@
 #include "CvPlayerManager.h"
 
 #include "CvDllUnit.h"
+#include "CvAStar.h"
 
 #include "LintFree.h"
 
@@ -4243,6 +4244,7 @@ void CvTeam::changeCanEmbarkCount(int iChange)
 	if(iChange != 0)
 	{
 		m_iCanEmbarkCount += iChange;
+		GC.GetStepFinder().ClearPathCache();
 
 		if(canEmbark())
 		{
@@ -4700,6 +4702,9 @@ void CvTeam::setAtWar(TeamTypes eIndex, bool bNewValue)
 		m_abAggressorPacifier[eIndex] = bAggressorPacifier;
 #endif
 		m_abAtWar[eIndex] = bNewValue;
+
+		//territory rules for generic paths depend on this
+		GC.GetStepFinder().ClearPathCache();
 #if defined(MOD_BALANCE_CORE)
 		for(int iAttackingPlayer = 0; iAttackingPlayer < MAX_MAJOR_CIVS; iAttackingPlayer++)
 		{
@@ -5168,6 +5173,7 @@ void CvTeam::SetAllowsOpenBordersToTeam(TeamTypes eIndex, bool bNewValue)
 		m_abOpenBorders[eIndex] = bNewValue;
 
 		GC.getMap().verifyUnitValidPlot();
+		GC.GetStepFinder().ClearPathCache();
 
 		if((GetID() == GC.getGame().getActiveTeam()) || (eIndex == GC.getGame().getActiveTeam()))
 		{
@@ -6713,6 +6719,10 @@ void CvTeam::setHasTech(TechTypes eIndex, bool bNewValue, PlayerTypes ePlayer, b
 					}
 				}
 			}
+#if defined(MOD_BALANCE_CORE)
+			//impassability may have changed on any plot, drop the generic paths once for the whole batch
+			GC.GetStepFinder().ClearPathCache();
+#endif
 		}
 #if defined(MOD_BALANCE_CORE)
 		processTech(eIndex, ((bNewValue) ? 1 : -1), bNoBonus);
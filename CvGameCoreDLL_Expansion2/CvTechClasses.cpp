@@ -1941,6 +1941,7 @@ void CvPlayerTechs::LogFlavors(FlavorTypes eFlavor)
 //=====================================
 /// Constructor
 CvTeamTechs::CvTeamTechs():
+	m_iTechChangeCount(0),
 	m_pabHasTech(NULL),
 	m_pabNoTradeTech(NULL),
 	m_paiResearchProgress(NULL),
@@ -1998,6 +1999,7 @@ void CvTeamTechs::Reset()
 	int iI;
 
 	m_eLastTechAcquired = NO_TECH;
+	m_iTechChangeCount++;
 
 	for(iI = 0; iI < m_pTechs->GetNumTechs(); iI++)
 	{
@@ -2090,6 +2092,7 @@ void CvTeamTechs::SetHasTech(TechTypes eIndex, bool bNewValue)
 	if(m_pabHasTech[eIndex] != bNewValue)
 	{
 		m_pabHasTech[eIndex] = bNewValue;
+		m_iTechChangeCount++;
 
 		if(bNewValue)
 			SetLastTechAcquired(eIndex);
@@ -2158,6 +2161,12 @@ int CvTeamTechs::GetNumTechsKnown() const
 	return iNumTechs;
 }
 
+/// Bumped whenever the team gains or loses a tech, so caches can tell if they are out of date
+int CvTeamTechs::GetTechChangeCount() const
+{
+	return m_iTechChangeCount;
+}
+
 /// Has this team researched all techs once?
 bool CvTeamTechs::HasResearchedAllTechs() const
 {
@@ -335,6 +335,7 @@ public:
 
 	int GetNumTechsKnown() const;
 	bool HasResearchedAllTechs() const;
+	int GetTechChangeCount() const;
 
 	void SetNoTradeTech(TechTypes eIndex, bool bNewValue);
 	bool IsNoTradeTech(TechTypes eIndex) const;
@@ -369,6 +370,7 @@ private:
 	int GetMaxResearchOverflow(TechTypes eTech, PlayerTypes ePlayer) const;
 
 	TechTypes m_eLastTechAcquired;
+	int m_iTechChangeCount; // not serialized, only good for noticing that the known techs changed
 
 	bool* m_pabHasTech;
 	bool* m_pabNoTradeTech;
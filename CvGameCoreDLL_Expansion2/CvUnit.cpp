@@ -5021,7 +5021,7 @@ int CvUnit::getCombatDamage(int iStrength, int iOpponentStrength, int iCurrentDa
 	{
 		if (isBarbarian())
 		{
-			iRoll = /*1200*/ (GC.getGame().getSmallFakeRandNum(10, *plot()) * 120);
+			iRoll = /*1200*/ (GC.getGame().getKeyedRandNum(10, RAND_STREAM_UNITS, getOwner(), plot()->GetPlotIndex()) * 120);
 		}
 		else
 		{
@@ -5172,7 +5172,7 @@ bool CvUnit::jumpToNearestValidPlot()
 				{
 					iValue += plotDistance(pLoopPlot->getX(), pLoopPlot->getY(), pNearestCity->getX(), pNearestCity->getY());
 				}
-				if(iValue < iBestValue || (iValue == iBestValue && GC.getGame().getSmallFakeRandNum(3, *pLoopPlot)<2))
+				if(iValue < iBestValue || (iValue == iBestValue && GC.getGame().getKeyedRandNum(3, RAND_STREAM_UNITS, getOwner(), pLoopPlot->GetPlotIndex())<2))
 				{
 					iBestValue = iValue;
 					pBestPlot = pLoopPlot;
@@ -5246,7 +5246,7 @@ bool CvUnit::jumpToNearestValidPlotWithinRange(int iRange)
 						{
 							iValue *= 3;
 						}
-						if(iValue < iBestValue || (iValue == iBestValue && GC.getGame().getSmallFakeRandNum(3, *pLoopPlot) < 2))
+						if(iValue < iBestValue || (iValue == iBestValue && GC.getGame().getKeyedRandNum(3, RAND_STREAM_UNITS, getOwner(), pLoopPlot->GetPlotIndex()) < 2))
 						{
 							iBestValue = iValue;
 							pBestPlot = pLoopPlot;
@@ -16323,7 +16323,7 @@ int CvUnit::GetRangeCombatDamage(const CvUnit* pDefender, CvCity* pCity, bool bI
 	{
 		if (isBarbarian())
 		{
-			iAttackerRoll = /*300*/ GC.getGame().getSmallFakeRandNum(10, GetID()) * 120;
+			iAttackerRoll = /*300*/ GC.getGame().getKeyedRandNum(10, RAND_STREAM_UNITS, getOwner(), GetID()) * 120;
 		}
 		else
 		{
@@ -26736,6 +26736,71 @@ bool CvUnit::ComputePath(const CvPlot* pToPlot, int iFlags, int iMaxTurns)
 		m_kLastPath.push_back( nextNode );
 	}
 
+	UpdateCachedPathVisibility();
+
+	// This helps in preventing us from trying to re-path to the same unreachable location.
+	m_uiLastPathCacheOrigin = plot()->GetPlotIndex();
+	m_uiLastPathCacheDestination = pToPlot->GetPlotIndex();
+	m_uiLastPathFlags = iFlags;
+	m_uiLastPathTurn = GC.getGame().getGameTurn();
+	m_uiLastPathLength = (!!newPath) ? m_kLastPath.size() : 0xFFFFFFFF; //length UINT_MAX means invalid
+	m_iLastPathCost = newPath.iTotalCost;
+
+	return !!newPath;
+}
+
+//	--------------------------------------------------------------------------------
+/// Keep the cached path from a previous turn if it can still be followed unchanged and has not become more expensive, otherwise the caller has to search again
+/// note that this never finds a better route which may have opened up in the meantime, the unit sticks to the old one until it is invalidated
+bool CvUnit::ReuseCachedPathIfStillValid(const CvPlot* pDestPlot, int iFlags, int iMaxTurns)
+{
+	// only a path which is otherwise identical to the one we would ask for is a candidate
+	if (m_kLastPath.empty() || !IsCachedPathValid() || m_uiLastPathLength != m_kLastPath.size() || m_iLastPathCost < 0)
+		return false;
+	if (m_uiLastPathCacheOrigin != plot()->GetPlotIndex() || m_uiLastPathCacheDestination != pDestPlot->GetPlotIndex() || m_uiLastPathFlags != iFlags)
+		return false;
+
+	// approximate targets are too fuzzy to check without a search
+	if (iFlags & (MOVEFLAG_APPROX_TARGET_RING1 | MOVEFLAG_APPROX_TARGET_RING2))
+		return false;
+	if (m_kLastPath.GetFinalPlot() != pDestPlot)
+		return false;
+
+	SPath oldPath;
+	oldPath.sConfig = SPathFinderUserData(this, iFlags, iMaxTurns);
+	oldPath.iTotalCost = m_iLastPathCost;
+	SPathNode kStartNode;
+	kStartNode.x = getX();
+	kStartNode.y = getY();
+	kStartNode.turns = 1;
+	kStartNode.moves = getMoves();
+	oldPath.vPlots.push_back(kStartNode);
+	for (size_t i = 0; i < m_kLastPath.size(); i++)
+	{
+		SPathNode kNode;
+		kNode.x = m_kLastPath[i].m_iX;
+		kNode.y = m_kLastPath[i].m_iY;
+		kNode.turns = m_kLastPath[i].m_iTurns;
+		kNode.moves = m_kLastPath[i].m_iMoves;
+		oldPath.vPlots.push_back(kNode);
+	}
+
+	// the pathfinder replays the old path with today's state of the map. it fails if the timing changed or the cost went up
+	if (!GC.GetPathFinder().IsPathStillValid(oldPath))
+		return false;
+
+	for (size_t i = 0; i < m_kLastPath.size(); i++)
+		m_kLastPath[i].ClearFlag(CvPathNode::PLOT_INVISIBLE | CvPathNode::PLOT_ADJACENT_INVISIBLE);
+	UpdateCachedPathVisibility();
+
+	m_uiLastPathTurn = GC.getGame().getGameTurn();
+	return true;
+}
+
+//	--------------------------------------------------------------------------------
+/// Flag the first invisible plot of the cached path, everything after it will need to be re-evaluated
+void CvUnit::UpdateCachedPathVisibility()
+{
 	if(!m_kLastPath.empty())
 	{
 		CvMap& kMap = GC.getMap();
@@ -26763,15 +26828,6 @@ bool CvUnit::ComputePath(const CvPlot* pToPlot, int iFlags, int iMaxTurns)
 			}
 		}
 	}
-
-	// This helps in preventing us from trying to re-path to the same unreachable location.
-	m_uiLastPathCacheOrigin = plot()->GetPlotIndex();
-	m_uiLastPathCacheDestination = pToPlot->GetPlotIndex();
-	m_uiLastPathFlags = iFlags;
-	m_uiLastPathTurn = GC.getGame().getGameTurn();
-	m_uiLastPathLength = (!!newPath) ? m_kLastPath.size() : 0xFFFFFFFF; //length UINT_MAX means invalid
-
-	return !!newPath;
 }
 
 //	---------------------------------------------------------------------------
@@ -26783,7 +26839,13 @@ bool CvUnit::VerifyCachedPath(const CvPlot* pDestPlot, int iFlags, int iMaxTurns
 	// we can assume that other than the unit that is moving, nothing on the map will change
 	// so we can re-use the cached path data most of the time
 	if (m_kLastPath.empty() || !HaveCachedPathTo(pDestPlot,iFlags))
+	{
+		// a path from the previous turn is often still good, checking it is much cheaper than a new search
+		if (ReuseCachedPathIfStillValid(pDestPlot, iFlags, iMaxTurns))
+			return true;
+
 		return ComputePath(pDestPlot, iFlags, iMaxTurns);
+	}
 
 	// Was the next plot invisible at the time of generation? See if it is visible now.
 	CvPlot* pkNextPlot = m_kLastPath.GetFirstPlot();
@@ -27170,11 +27232,13 @@ int CvUnit::UnitPathTo(int iX, int iY, int iFlags, int iPrevETA, bool bBuildingR
 		if (bMoved)
 		{
 			//this plot has now been consumed
+			int iConsumedCost = m_kLastPath.front().m_iKnownCost;
 			m_kLastPath.pop_front();
 
 			//keep the cache in sync
 			m_uiLastPathCacheOrigin = plot()->GetPlotIndex();
 			m_uiLastPathLength = m_kLastPath.size();
+			m_iLastPathCost = m_kLastPath.empty() ? 0 : m_kLastPath.back().m_iKnownCost - iConsumedCost;
 
 			//have we used up all plots for this turn?
 			if (!m_kLastPath.empty() && m_kLastPath.front().m_iTurns>1)
@@ -28029,6 +28093,7 @@ void CvUnit::ClearPathCache()
 	m_uiLastPathFlags = 0xFFFFFFFF;
 	m_uiLastPathTurn = 0xFFFFFFFF;
 	m_uiLastPathLength = 0xFFFFFFFF;
+	m_iLastPathCost = -1;
 }
 
 //	--------------------------------------------------------------------------------
@@ -29177,7 +29242,7 @@ int CvUnit::AI_promotionValue(PromotionTypes ePromotion)
 	if(iValue > 0)
 	{
 #if defined(MOD_CORE_REDUCE_RANDOMNESS)
-		iValue += GC.getGame().getSmallFakeRandNum(11, iValue);
+		iValue += GC.getGame().getKeyedRandNum(11, RAND_STREAM_UNITS, getOwner(), iValue);
 #else
 		iValue += GC.getGame().getJonRandNum(15, "AI Promote");
 #endif
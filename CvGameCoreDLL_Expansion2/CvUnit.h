@@ -1674,6 +1674,8 @@ protected:
 	bool IsCachedPathValid();
 	bool VerifyCachedPath(const CvPlot* pDestPlot, int iFlags, int iMaxTurns);
 	bool ComputePath(const CvPlot* pToPlot, int iFlags, int iMaxTurns);
+	bool ReuseCachedPathIfStillValid(const CvPlot* pDestPlot, int iFlags, int iMaxTurns);
+	void UpdateCachedPathVisibility();
 
 	bool HasQueuedVisualizationMoves() const;
 	void QueueMoveForVisualization(CvPlot* pkPlot);
@@ -2025,6 +2027,7 @@ protected:
 	mutable uint m_uiLastPathFlags;
 	mutable uint m_uiLastPathTurn;
 	mutable uint m_uiLastPathLength;
+	mutable int m_iLastPathCost; // cost of the remaining cached path, from the unit's plot to the destination
 
 	bool canAdvance(const CvPlot& pPlot, int iThreshold) const;
 
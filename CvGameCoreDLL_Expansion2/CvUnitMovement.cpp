@@ -306,8 +306,12 @@ int CvUnitMovement::MovementCostSelectiveZOC(const CvUnit* pUnit, const CvPlot*
 //	---------------------------------------------------------------------------
 int CvUnitMovement::MovementCostNoZOC(const CvUnit* pUnit, const CvPlot* pFromPlot, const CvPlot* pToPlot, int iMovesRemaining, int iMaxMoves)
 {
-	int iCost = GetCostsForMove(pUnit, pFromPlot, pToPlot);
+	return LimitMovementCost(GetCostsForMove(pUnit, pFromPlot, pToPlot), iMovesRemaining, iMaxMoves);
+}
 
+//	---------------------------------------------------------------------------
+int CvUnitMovement::LimitMovementCost(int iCost, int iMovesRemaining, int iMaxMoves)
+{
 	//now, if there was a domain change, our base moves might change
 	//make sure that the movement cost is always so high that we never end up with more than the base moves for the new domain
 	int iLeftOverMoves = iMovesRemaining-iCost;
@@ -317,6 +321,93 @@ int CvUnitMovement::MovementCostNoZOC(const CvUnit* pUnit, const CvPlot* pFromPl
 	return std::min( iCost, iMovesRemaining );
 }
 
+//	--------------------------------------------------------------------------------
+/// Which kinds of zone of control does this plot exert on the given unit? Does not depend on the move itself,
+/// so the pathfinder can evaluate it once per plot and combine it with the embarkation state of each move later
+int CvUnitMovement::GetZOCSources(const CvUnit* pUnit, const CvPlot* pAdjPlot, bool bSelective)
+{
+	if(!pAdjPlot)
+		return ZOC_SOURCE_NONE;
+
+	// check city zone of control
+	if(pAdjPlot->isEnemyCity(*pUnit))
+		return ZOC_SOURCE_ALWAYS;
+
+	TeamTypes eUnitTeam = pUnit->getTeam();
+	DomainTypes eUnitDomain = pUnit->getDomainType();
+	CvTeam& kUnitTeam = GET_TEAM(eUnitTeam);
+	int iSources = ZOC_SOURCE_NONE;
+
+	// Loop through all units to see if there's an enemy unit here
+	IDInfo* pAdjUnitNode = pAdjPlot->headUnitNode();
+	while(pAdjUnitNode != NULL)
+	{
+		CvUnit* pLoopUnit = NULL;
+		if((pAdjUnitNode->eOwner >= 0) && pAdjUnitNode->eOwner < MAX_PLAYERS)
+			pLoopUnit = (GET_PLAYER(pAdjUnitNode->eOwner).getUnit(pAdjUnitNode->iID));
+
+		pAdjUnitNode = pAdjPlot->nextUnitNode(pAdjUnitNode);
+
+		if(!pLoopUnit) 
+			continue;
+
+		//the selective version used by the tactical AI also looks at units which are about to die
+		if(!bSelective && pLoopUnit->isDelayedDeath())
+			continue;
+
+		if(pLoopUnit->isInvisible(eUnitTeam,false))
+			continue;
+
+		// Combat unit?
+		if(!pLoopUnit->IsCombatUnit())
+			continue;
+
+		// Embarked units don't have ZOC
+		if(pLoopUnit->isEmbarked())
+			continue;
+
+		// At war with this unit's team?
+		TeamTypes eLoopUnitTeam = pLoopUnit->getTeam();
+		if( (bSelective && eLoopUnitTeam == BARBARIAN_TEAM) || kUnitTeam.isAtWar(eLoopUnitTeam) || pLoopUnit->isAlwaysHostile(*pAdjPlot) )
+		{
+			// Same Domain?
+			DomainTypes eLoopUnitDomain = pLoopUnit->getDomainType();
+			if(eLoopUnitDomain != eUnitDomain)
+			{
+				// hovering units always exert a ZOC
+				if (pLoopUnit->IsHoveringUnit() || eLoopUnitDomain==DOMAIN_HOVER)
+					return ZOC_SOURCE_ALWAYS;
+				// water unit can ZoC embarked land unit
+				else if(eLoopUnitDomain == DOMAIN_SEA)
+					iSources |= ZOC_SOURCE_IF_EITHER_EMBARKED;
+			}
+			else
+			{
+				//land units don't ZoC embarked units (if they stay embarked)
+				if(eLoopUnitDomain == DOMAIN_LAND)
+					iSources |= ZOC_SOURCE_UNLESS_BOTH_EMBARKED;
+				else
+					return ZOC_SOURCE_ALWAYS;
+			}
+		}
+	}
+
+	return iSources;
+}
+
+//	--------------------------------------------------------------------------------
+bool CvUnitMovement::IsSlowedByZOCSources(int iSources, bool bFromNeedsEmbarkation, bool bToNeedsEmbarkation)
+{
+	if(iSources & ZOC_SOURCE_ALWAYS)
+		return true;
+	if((iSources & ZOC_SOURCE_UNLESS_BOTH_EMBARKED) && !(bFromNeedsEmbarkation && bToNeedsEmbarkation))
+		return true;
+	if((iSources & ZOC_SOURCE_IF_EITHER_EMBARKED) && (bFromNeedsEmbarkation || bToNeedsEmbarkation))
+		return true;
+
+	return false;
+}
+
 //	--------------------------------------------------------------------------------
 bool CvUnitMovement::IsSlowedByZOC(const CvUnit* pUnit, const CvPlot* pFromPlot, const CvPlot* pToPlot, const set<int>& plotsToIgnore)
 {
@@ -327,10 +418,6 @@ bool CvUnitMovement::IsSlowedByZOC(const CvUnit* pUnit, const CvPlot* pFromPlot,
 	if(GC.getZONE_OF_CONTROL_ENABLED() <= 0)
 		return false;
 
-	TeamTypes eUnitTeam = pUnit->getTeam();
-	DomainTypes eUnitDomain = pUnit->getDomainType();
-	CvTeam& kUnitTeam = GET_TEAM(eUnitTeam);
-
 	//there are only two plots we need to check
 	DirectionTypes moveDir = directionXY(pFromPlot,pToPlot);
 	int eRight = (int(moveDir) + 1) % 6;
@@ -348,71 +435,9 @@ bool CvUnitMovement::IsSlowedByZOC(const CvUnit* pUnit, const CvPlot* pFromPlot,
 		if(plotsToIgnore.find(pAdjPlot->GetPlotIndex())!=plotsToIgnore.end())
 			continue;
 
-		// check city zone of control
-		if(pAdjPlot->isEnemyCity(*pUnit))
+		int iSources = GetZOCSources(pUnit, pAdjPlot, true);
+		if(iSources != ZOC_SOURCE_NONE && IsSlowedByZOCSources(iSources, pFromPlot->needsEmbarkation(pUnit), pToPlot->needsEmbarkation(pUnit)))
 			return true;
-
-		// Loop through all units to see if there's an enemy unit here
-		IDInfo* pAdjUnitNode = pAdjPlot->headUnitNode();
-		while(pAdjUnitNode != NULL)
-		{
-			CvUnit* pLoopUnit = NULL;
-			if((pAdjUnitNode->eOwner >= 0) && pAdjUnitNode->eOwner < MAX_PLAYERS)
-				pLoopUnit = (GET_PLAYER(pAdjUnitNode->eOwner).getUnit(pAdjUnitNode->iID));
-
-			pAdjUnitNode = pAdjPlot->nextUnitNode(pAdjUnitNode);
-
-			if(!pLoopUnit) 
-				continue;
-
-			if(pLoopUnit->isInvisible(eUnitTeam,false))
-				continue;
-
-			// Combat unit?
-			if(!pLoopUnit->IsCombatUnit())
-				continue;
-
-			// Embarked units don't have ZOC
-			if(pLoopUnit->isEmbarked())
-				continue;
-
-			// At war with this unit's team?
-			TeamTypes eLoopUnitTeam = pLoopUnit->getTeam();
-			if(eLoopUnitTeam == BARBARIAN_TEAM || kUnitTeam.isAtWar(eLoopUnitTeam) || pLoopUnit->isAlwaysHostile(*pAdjPlot) )
-			{
-				// Same Domain?
-				DomainTypes eLoopUnitDomain = pLoopUnit->getDomainType();
-				if(eLoopUnitDomain != eUnitDomain)
-				{
-					// hovering units always exert a ZOC
-					if (pLoopUnit->IsHoveringUnit() || eLoopUnitDomain==DOMAIN_HOVER)
-					{
-						// continue on
-					}
-					// water unit can ZoC embarked land unit
-					else if(eLoopUnitDomain == DOMAIN_SEA && (pToPlot->needsEmbarkation(pUnit) || pFromPlot->needsEmbarkation(pUnit)) )
-					{
-						// continue on
-					}
-					else
-					{
-						// ignore this unit
-						continue;
-					}
-				}
-				else
-				{
-					//land units don't ZoC embarked units (if they stay embarked)
-					if(eLoopUnitDomain == DOMAIN_LAND && pToPlot->needsEmbarkation(pUnit) && pFromPlot->needsEmbarkation(pUnit))
-					{
-						continue;
-					}
-				}
-
-				//ok, all conditions fulfilled
-				return true;
-			}
-		}
 	}
 
 	return false;
@@ -428,10 +453,6 @@ bool CvUnitMovement::IsSlowedByZOC(const CvUnit* pUnit, const CvPlot* pFromPlot,
 	if(GC.getZONE_OF_CONTROL_ENABLED() <= 0)
 		return false;
 
-	TeamTypes eUnitTeam = pUnit->getTeam();
-	DomainTypes eUnitDomain = pUnit->getDomainType();
-	CvTeam& kUnitTeam = GET_TEAM(eUnitTeam);
-
 	//there are only two plots we need to check
 	DirectionTypes moveDir = directionXY(pFromPlot,pToPlot);
 	int eRight = (int(moveDir) + 1) % 6;
@@ -441,75 +462,9 @@ bool CvUnitMovement::IsSlowedByZOC(const CvUnit* pUnit, const CvPlot* pFromPlot,
 	aPlotsToCheck[1] = plotDirection(pFromPlot->getX(),pFromPlot->getY(),(DirectionTypes)eLeft);
 	for (int iCount=0; iCount<2; iCount++)
 	{
-		CvPlot* pAdjPlot = aPlotsToCheck[iCount];
-		if(!pAdjPlot)
-			continue;
-
-		// check city zone of control
-		if(pAdjPlot->isEnemyCity(*pUnit))
+		int iSources = GetZOCSources(pUnit, aPlotsToCheck[iCount], false);
+		if(iSources != ZOC_SOURCE_NONE && IsSlowedByZOCSources(iSources, pFromPlot->needsEmbarkation(pUnit), pToPlot->needsEmbarkation(pUnit)))
 			return true;
-
-		// Loop through all units to see if there's an enemy unit here
-		IDInfo* pAdjUnitNode = pAdjPlot->headUnitNode();
-		while(pAdjUnitNode != NULL)
-		{
-			CvUnit* pLoopUnit = NULL;
-			if((pAdjUnitNode->eOwner >= 0) && pAdjUnitNode->eOwner < MAX_PLAYERS)
-				pLoopUnit = (GET_PLAYER(pAdjUnitNode->eOwner).getUnit(pAdjUnitNode->iID));
-
-			pAdjUnitNode = pAdjPlot->nextUnitNode(pAdjUnitNode);
-
-			if(!pLoopUnit || pLoopUnit->isDelayedDeath()) 
-				continue;
-
-			if(pLoopUnit->isInvisible(eUnitTeam,false))
-				continue;
-
-			// Combat unit?
-			if(!pLoopUnit->IsCombatUnit())
-				continue;
-
-			// Embarked units don't have ZOC
-			if(pLoopUnit->isEmbarked())
-				continue;
-
-			// At war with this unit's team?
-			TeamTypes eLoopUnitTeam = pLoopUnit->getTeam();
-			if(kUnitTeam.isAtWar(eLoopUnitTeam) || pLoopUnit->isAlwaysHostile(*pAdjPlot))
-			{
-				// Same Domain?
-				DomainTypes eLoopUnitDomain = pLoopUnit->getDomainType();
-				if(eLoopUnitDomain != eUnitDomain)
-				{
-					// hovering units always exert a ZOC
-					if (pLoopUnit->IsHoveringUnit() || eLoopUnitDomain==DOMAIN_HOVER)
-					{
-						// continue on
-					}
-					// water unit can ZoC embarked land unit
-					else if(eLoopUnitDomain == DOMAIN_SEA && (pToPlot->needsEmbarkation(pUnit) || pFromPlot->needsEmbarkation(pUnit)) )
-					{
-						// continue on
-					}
-					else
-					{
-						// ignore this unit
-						continue;
-					}
-				}
-				else
-				{
-					//land units don't ZoC embarked units (if they stay embarked)
-					if(eLoopUnitDomain == DOMAIN_LAND && pToPlot->needsEmbarkation(pUnit) && pFromPlot->needsEmbarkation(pUnit))
-					{
-						continue;
-					}
-				}
-
-				//ok, all conditions fulfilled
-				return true;
-			}
-		}
 	}
 
 	return false;
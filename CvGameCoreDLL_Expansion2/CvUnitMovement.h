@@ -12,8 +12,22 @@ public:
 	static int MovementCostSelectiveZOC(const CvUnit* pUnit, const CvPlot* pFromPlot, const CvPlot* pToPlot, int iMovesRemaining, int iMaxMoves, const set<int>& plotsToIgnore);
 	static int MovementCostNoZOC(const CvUnit* pUnit, const CvPlot* pFromPlot, const CvPlot* pToPlot, int iMovesRemaining, int iMaxMoves);
 
-protected:
+	//the part of the movement cost which depends only on the unit and the two plots, not on the remaining moves
 	static int GetCostsForMove(const CvUnit* pUnit, const CvPlot* pFromPlot, const CvPlot* pToPlot);
+	static int LimitMovementCost(int iCost, int iMovesRemaining, int iMaxMoves);
+
+	//the zone of control a single plot exerts on the given unit, independent of the move direction
+	enum ZOCSourceFlags
+	{
+		ZOC_SOURCE_NONE = 0,
+		ZOC_SOURCE_ALWAYS = 1,					//enemy city, hovering unit or non-land unit of our own domain
+		ZOC_SOURCE_UNLESS_BOTH_EMBARKED = 2,	//land unit, but only if we are a land unit as well
+		ZOC_SOURCE_IF_EITHER_EMBARKED = 4,		//naval unit, but only if we are a (possibly embarked) land unit
+	};
+	static int GetZOCSources(const CvUnit* pUnit, const CvPlot* pAdjPlot, bool bSelective);
+	static bool IsSlowedByZOCSources(int iSources, bool bFromNeedsEmbarkation, bool bToNeedsEmbarkation);
+
+protected:
 	static bool IsSlowedByZOC(const CvUnit* pUnit, const CvPlot* pFromPlot, const CvPlot* pToPlot);
 	static bool IsSlowedByZOC(const CvUnit* pUnit, const CvPlot* pFromPlot, const CvPlot* pToPlot, const set<int>& plotsToIgnore);
 };
@@ -8427,6 +8427,7 @@ CvGameLeagues::CvGameLeagues(void)
 	m_eDiplomaticVictor = NO_PLAYER;
 	m_iGeneratedIDCount = 0;
 	m_eLastEraTrigger = NO_ERA;
+	m_iProposalImpactPassDepth = 0;
 }
 
 CvGameLeagues::~CvGameLeagues(void)
@@ -8563,6 +8564,8 @@ void CvGameLeagues::DoPlayerTurn(CvPlayer& kPlayer)
 	if (!GC.getGame().isOption(GAMEOPTION_NO_LEAGUES))
 	{
 		AI_PERF_FORMAT("AI-perf.csv", ("CvGameLeagues::DoPlayerTurn, Turn %03d, %s", GC.getGame().getElapsedGameTurns(), kPlayer.getCivilizationShortDescription()) );
+		// nothing below changes influence or tourism, so all proposals and choices can be scored against one snapshot
+		BeginProposalImpactPass();
 		for (LeagueList::iterator it = m_vActiveLeagues.begin(); it != m_vActiveLeagues.end(); it++)
 		{
 			if (it->IsMember(kPlayer.GetID()))
@@ -8650,6 +8653,7 @@ void CvGameLeagues::DoPlayerTurn(CvPlayer& kPlayer)
 				}
 			}
 		}
+		EndProposalImpactPass();
 	}
 }
 
@@ -9143,6 +9147,51 @@ bool CvGameLeagues::IsIdeologyEmbargoed(PlayerTypes eTrader, PlayerTypes eRecipi
 }
 #endif
 
+int CvGameLeagues::GetProposalImpactNumCivsInfluentialOn(PlayerTypes ePlayer)
+{
+	if (m_iProposalImpactPassDepth == 0 || ePlayer < 0 || ePlayer >= MAX_MAJOR_CIVS)
+		return GET_PLAYER(ePlayer).GetCulture()->GetNumCivsInfluentialOn();
+
+	return m_aiProposalImpactNumCivsInfluentialOn[ePlayer];
+}
+
+int CvGameLeagues::GetProposalImpactTourism(PlayerTypes ePlayer)
+{
+	if (m_iProposalImpactPassDepth == 0 || ePlayer < 0 || ePlayer >= MAX_MAJOR_CIVS)
+		return GET_PLAYER(ePlayer).GetCulture()->GetTourism();
+
+	return m_aiProposalImpactTourism[ePlayer];
+}
+
+/// Start scoring proposals - influence and tourism are taken as they are now until the matching EndProposalImpactPass()
+void CvGameLeagues::BeginProposalImpactPass()
+{
+	if (m_iProposalImpactPassDepth++ > 0)
+		return;
+
+	for (int iPlayerLoop = 0; iPlayerLoop < MAX_MAJOR_CIVS; iPlayerLoop++)
+	{
+		CvPlayer& kPlayer = GET_PLAYER((PlayerTypes) iPlayerLoop);
+		if (kPlayer.isAlive())
+		{
+			m_aiProposalImpactNumCivsInfluentialOn[iPlayerLoop] = kPlayer.GetCulture()->GetNumCivsInfluentialOn();
+			m_aiProposalImpactTourism[iPlayerLoop] = kPlayer.GetCulture()->GetTourism();
+		}
+		else
+		{
+			m_aiProposalImpactNumCivsInfluentialOn[iPlayerLoop] = 0;
+			m_aiProposalImpactTourism[iPlayerLoop] = 0;
+		}
+	}
+}
+
+void CvGameLeagues::EndProposalImpactPass()
+{
+	CvAssertMsg(m_iProposalImpactPassDepth > 0, "Ending a proposal impact pass that was never started.");
+	if (m_iProposalImpactPassDepth > 0)
+		m_iProposalImpactPassDepth--;
+}
+
 CvString CvGameLeagues::GetLogFileName() const
 {
 	CvString strLogName;
@@ -9418,6 +9467,7 @@ CvLeagueAI::VoteCommitmentList CvLeagueAI::GetDesiredVoteCommitments(PlayerTypes
 {
 	VoteCommitmentList vDesired;
 
+	GC.getGame().GetGameLeagues()->BeginProposalImpactPass();
 	if (GC.getGame().GetGameLeagues()->GetNumActiveLeagues() > 0)
 	{
 		CvLeague* pLeague = GC.getGame().GetGameLeagues()->GetActiveLeague();
@@ -9645,6 +9695,7 @@ CvLeagueAI::VoteCommitmentList CvLeagueAI::GetDesiredVoteCommitments(PlayerTypes
 			}
 		}
 	}
+	GC.getGame().GetGameLeagues()->EndProposalImpactPass();
 
 	return vDesired;
 }
@@ -12841,7 +12892,7 @@ int CvLeagueAI::ScoreVoteChoiceYesNo(CvProposal* pProposal, int iChoice, bool bE
 			iScore -= 1000;
 		}
 		int iTotalCivs = GC.getGame().countMajorCivsAlive();
-		int iCivs = GetPlayer()->GetCulture()->GetNumCivsInfluentialOn();
+		int iCivs = GC.getGame().GetGameLeagues()->GetProposalImpactNumCivsInfluentialOn(GetPlayer()->GetID());
 		int iMyPercent = ((iCivs * 100) / iTotalCivs);		
 		if(iCivs > 0)
 		{
@@ -12865,9 +12916,9 @@ int CvLeagueAI::ScoreVoteChoiceYesNo(CvProposal* pProposal, int iChoice, bool bE
 			if(!GET_PLAYER(eLoopPlayer).isMinorCiv() && !GET_PLAYER(eLoopPlayer).isBarbarian() && GET_PLAYER(eLoopPlayer).isAlive())
 			{
 				//Do they have more influence than us?
-				int iTheirInfluence = GET_PLAYER(eLoopPlayer).GetCulture()->GetNumCivsInfluentialOn();
+				int iTheirInfluence = GC.getGame().GetGameLeagues()->GetProposalImpactNumCivsInfluentialOn(eLoopPlayer);
 				int iTheirPercent = ((iTheirInfluence * 100) / iTotalCivs);
-				if(GET_PLAYER(eLoopPlayer).GetCulture()->GetNumCivsInfluentialOn() > iCivs)
+				if(iTheirInfluence > iCivs)
 				{
 					iScore += 50;
 				}
@@ -12883,7 +12934,7 @@ int CvLeagueAI::ScoreVoteChoiceYesNo(CvProposal* pProposal, int iChoice, bool bE
 				{
 					iScore += 100;
 				}
-				if(GET_PLAYER(eLoopPlayer).GetCulture()->GetTourism() > GetPlayer()->GetCulture()->GetTourism())
+				if(GC.getGame().GetGameLeagues()->GetProposalImpactTourism(eLoopPlayer) > GC.getGame().GetGameLeagues()->GetProposalImpactTourism(GetPlayer()->GetID()))
 				{
 					iScore += 50;
 				}
@@ -12899,7 +12950,7 @@ int CvLeagueAI::ScoreVoteChoiceYesNo(CvProposal* pProposal, int iChoice, bool bE
 			iScore += 1000;
 		}
 		int iTotalCivs = GC.getGame().countMajorCivsAlive();
-		int iCivs = GetPlayer()->GetCulture()->GetNumCivsInfluentialOn();
+		int iCivs = GC.getGame().GetGameLeagues()->GetProposalImpactNumCivsInfluentialOn(GetPlayer()->GetID());
 		int iMyPercent = ((iCivs * 100) / iTotalCivs);		
 		if(iCivs > 0)
 		{
@@ -12926,9 +12977,9 @@ int CvLeagueAI::ScoreVoteChoiceYesNo(CvProposal* pProposal, int iChoice, bool bE
 			if(!GET_PLAYER(eLoopPlayer).isMinorCiv() && !GET_PLAYER(eLoopPlayer).isBarbarian() && GET_PLAYER(eLoopPlayer).isAlive())
 			{
 				//Do they have more influence than us?
-				int iTheirInfluence = GET_PLAYER(eLoopPlayer).GetCulture()->GetNumCivsInfluentialOn();
+				int iTheirInfluence = GC.getGame().GetGameLeagues()->GetProposalImpactNumCivsInfluentialOn(eLoopPlayer);
 				int iTheirPercent = ((iTheirInfluence * 100) / iTotalCivs);
-				if(GET_PLAYER(eLoopPlayer).GetCulture()->GetNumCivsInfluentialOn() > iCivs)
+				if(iTheirInfluence > iCivs)
 				{
 					iScore -= 100;
 				}
@@ -12944,7 +12995,7 @@ int CvLeagueAI::ScoreVoteChoiceYesNo(CvProposal* pProposal, int iChoice, bool bE
 				{
 					iScore -= 250;
 				}
-				if(GET_PLAYER(eLoopPlayer).GetCulture()->GetTourism() > GetPlayer()->GetCulture()->GetTourism())
+				if(GC.getGame().GetGameLeagues()->GetProposalImpactTourism(eLoopPlayer) > GC.getGame().GetGameLeagues()->GetProposalImpactTourism(GetPlayer()->GetID()))
 				{
 					iScore -= 100;
 				}
@@ -767,6 +767,12 @@ public:
 	bool IsIdeologyEmbargoed(PlayerTypes eTrader, PlayerTypes eRecipient);
 #endif
 
+	// Proposal Impact - per-player figures that AI members look at when scoring proposals, snapshotted for the duration of a pass
+	int GetProposalImpactNumCivsInfluentialOn(PlayerTypes ePlayer);
+	int GetProposalImpactTourism(PlayerTypes ePlayer);
+	void BeginProposalImpactPass();
+	void EndProposalImpactPass();
+
 	// General Logging
 	CvString GetLogFileName() const;
 	void LogLeagueMessage(CvString& kMessage);
@@ -781,6 +787,11 @@ private:
 	// Logging
 	void LogLeagueFounded(PlayerTypes eFounder);
 	void LogSpecialSession(LeagueSpecialSessionTypes eSpecialSession);
+
+	// Not serialized, only valid while a pass is open
+	int m_iProposalImpactPassDepth;
+	int m_aiProposalImpactNumCivsInfluentialOn[MAX_MAJOR_CIVS];
+	int m_aiProposalImpactTourism[MAX_MAJOR_CIVS];
 };
 
 FDataStream& operator>>(FDataStream&, CvGameLeagues&);
@@ -907,6 +907,11 @@ void CvLuaPlayer::PushMethods(lua_State* L, int t)
 	Method(GetNumUnitsNoCivlian);
 #endif
 	Method(GetUnitByID);
+#if defined(MOD_API_LUA_EXTENSIONS)
+	Method(GetSnapshot);
+	Method(GetCitySnapshots);
+	Method(GetUnitSnapshots);
+#endif
 
 	Method(AI_updateFoundValues);
 	Method(AI_foundValue);
@@ -9242,6 +9247,171 @@ int CvLuaPlayer::lGetNumUnitsNoCivlian(lua_State* L)
 	return BasicLuaMethod(L, &CvPlayerAI::getNumUnitsNoCivilian);
 }
 #endif
+#if defined(MOD_API_LUA_EXTENSIONS)
+//------------------------------------------------------------------------------
+//table GetSnapshot();
+//the values overview screens usually ask for one by one, in a single call
+int CvLuaPlayer::lGetSnapshot(lua_State* L)
+{
+	CvPlayerAI* pkPlayer = GetInstance(L);
+
+	lua_createtable(L, 0, 10);
+	const int t = lua_gettop(L);
+
+	lua_pushinteger(L, pkPlayer->GetTreasury()->GetGold());
+	lua_setfield(L, t, "Gold");
+	lua_pushinteger(L, pkPlayer->calculateGoldRate());
+	lua_setfield(L, t, "GoldRate");
+	lua_pushinteger(L, pkPlayer->GetScience());
+	lua_setfield(L, t, "Science");
+	lua_pushinteger(L, pkPlayer->GetTotalJONSCulturePerTurn());
+	lua_setfield(L, t, "Culture");
+	lua_pushinteger(L, pkPlayer->GetTotalFaithPerTurn());
+	lua_setfield(L, t, "Faith");
+	lua_pushinteger(L, pkPlayer->GetCulture()->GetTourism());
+	lua_setfield(L, t, "Tourism");
+	lua_pushinteger(L, pkPlayer->GetExcessHappiness());
+	lua_setfield(L, t, "ExcessHappiness");
+	lua_pushinteger(L, pkPlayer->GetScore());
+	lua_setfield(L, t, "Score");
+	lua_pushinteger(L, pkPlayer->getNumCities());
+	lua_setfield(L, t, "NumCities");
+	lua_pushinteger(L, pkPlayer->getNumUnits());
+	lua_setfield(L, t, "NumUnits");
+
+	return 1;
+}
+//------------------------------------------------------------------------------
+//table GetCitySnapshots();
+//one entry per city with the commonly displayed values, same numbers as the individual city accessors
+int CvLuaPlayer::lGetCitySnapshots(lua_State* L)
+{
+	CvPlayerAI* pkPlayer = GetInstance(L);
+
+	lua_createtable(L, pkPlayer->getNumCities(), 0);
+	const int t = lua_gettop(L);
+	int idx = 1;
+
+	int iLoop;
+	for(CvCity* pLoopCity = pkPlayer->firstCity(&iLoop); pLoopCity != NULL; pLoopCity = pkPlayer->nextCity(&iLoop))
+	{
+		lua_createtable(L, 0, 20);
+		const int c = lua_gettop(L);
+
+		CvLuaCity::Push(L, pLoopCity);
+		lua_setfield(L, c, "City");
+		lua_pushinteger(L, pLoopCity->GetID());
+		lua_setfield(L, c, "ID");
+		lua_pushstring(L, pLoopCity->getName());
+		lua_setfield(L, c, "Name");
+		lua_pushinteger(L, pLoopCity->getX());
+		lua_setfield(L, c, "X");
+		lua_pushinteger(L, pLoopCity->getY());
+		lua_setfield(L, c, "Y");
+		lua_pushinteger(L, pLoopCity->getPopulation());
+		lua_setfield(L, c, "Population");
+		lua_pushinteger(L, pLoopCity->getFoodTurnsLeft());
+		lua_setfield(L, c, "FoodTurnsLeft");
+		lua_pushinteger(L, pLoopCity->getProductionTurnsLeft());
+		lua_setfield(L, c, "ProductionTurnsLeft");
+		lua_pushstring(L, pLoopCity->getProductionNameKey());
+		lua_setfield(L, c, "ProductionNameKey");
+		lua_pushinteger(L, pLoopCity->getJONSCulturePerTurn());
+		lua_setfield(L, c, "Culture");
+		lua_pushinteger(L, pLoopCity->GetFaithPerTurn());
+		lua_setfield(L, c, "Faith");
+#if defined(MOD_BALANCE_CORE)
+		lua_pushinteger(L, pLoopCity->GetBaseTourism());
+#else
+		lua_pushinteger(L, pLoopCity->GetCityCulture()->GetBaseTourism());
+#endif
+		lua_setfield(L, c, "BaseTourism");
+		lua_pushinteger(L, pLoopCity->getStrengthValue());
+		lua_setfield(L, c, "Strength");
+		lua_pushinteger(L, pLoopCity->getDamage());
+		lua_setfield(L, c, "Damage");
+		lua_pushinteger(L, pLoopCity->GetMaxHitPoints());
+		lua_setfield(L, c, "MaxHitPoints");
+		lua_pushboolean(L, pLoopCity->isCapital());
+		lua_setfield(L, c, "IsCapital");
+		lua_pushboolean(L, pLoopCity->IsPuppet());
+		lua_setfield(L, c, "IsPuppet");
+		lua_pushboolean(L, pLoopCity->IsOccupied());
+		lua_setfield(L, c, "IsOccupied");
+		lua_pushboolean(L, pLoopCity->IsRazing());
+		lua_setfield(L, c, "IsRazing");
+
+		//indexed by YieldTypes, like getYieldRate(eYield)
+		lua_createtable(L, 0, NUM_YIELD_TYPES);
+		const int y = lua_gettop(L);
+		for(int iI = 0; iI < NUM_YIELD_TYPES; iI++)
+		{
+			lua_pushinteger(L, pLoopCity->getYieldRate((YieldTypes)iI, false));
+			lua_rawseti(L, y, iI);
+		}
+		lua_setfield(L, c, "YieldRate");
+
+		lua_rawseti(L, t, idx++);
+	}
+
+	return 1;
+}
+//------------------------------------------------------------------------------
+//table GetUnitSnapshots();
+//one entry per unit with the commonly displayed values, same numbers as the individual unit accessors
+int CvLuaPlayer::lGetUnitSnapshots(lua_State* L)
+{
+	CvPlayerAI* pkPlayer = GetInstance(L);
+
+	lua_createtable(L, pkPlayer->getNumUnits(), 0);
+	const int t = lua_gettop(L);
+	int idx = 1;
+
+	int iLoop;
+	for(CvUnit* pLoopUnit = pkPlayer->firstUnit(&iLoop); pLoopUnit != NULL; pLoopUnit = pkPlayer->nextUnit(&iLoop))
+	{
+		lua_createtable(L, 0, 14);
+		const int u = lua_gettop(L);
+
+		CvLuaUnit::Push(L, pLoopUnit);
+		lua_setfield(L, u, "Unit");
+		lua_pushinteger(L, pLoopUnit->GetID());
+		lua_setfield(L, u, "ID");
+		lua_pushinteger(L, pLoopUnit->getUnitType());
+		lua_setfield(L, u, "UnitType");
+		lua_pushinteger(L, pLoopUnit->getX());
+		lua_setfield(L, u, "X");
+		lua_pushinteger(L, pLoopUnit->getY());
+		lua_setfield(L, u, "Y");
+		lua_pushinteger(L, pLoopUnit->getDamage());
+		lua_setfield(L, u, "Damage");
+		lua_pushinteger(L, pLoopUnit->GetMaxHitPoints());
+		lua_setfield(L, u, "MaxHitPoints");
+		lua_pushinteger(L, pLoopUnit->getMoves());
+		lua_setfield(L, u, "Moves");
+		lua_pushinteger(L, pLoopUnit->maxMoves());
+		lua_setfield(L, u, "MaxMoves");
+		lua_pushinteger(L, pLoopUnit->getLevel());
+		lua_setfield(L, u, "Level");
+#if defined(MOD_UNITS_XP_TIMES_100)
+		lua_pushinteger(L, pLoopUnit->getExperienceTimes100() / 100);
+#else
+		lua_pushinteger(L, pLoopUnit->getExperience());
+#endif
+		lua_setfield(L, u, "Experience");
+		lua_pushinteger(L, pLoopUnit->GetBaseCombatStrength());
+		lua_setfield(L, u, "BaseCombatStrength");
+		lua_pushboolean(L, pLoopUnit->IsCombatUnit());
+		lua_setfield(L, u, "IsCombatUnit");
+		lua_pushboolean(L, pLoopUnit->isEmbarked());
+		lua_setfield(L, u, "IsEmbarked");
+
+		lua_rawseti(L, t, idx++);
+	}
+
+	return 1;
+}
+#endif
 //------------------------------------------------------------------------------
 //void AI_updateFoundValues(bool bStartingLoc);
 int CvLuaPlayer::lAI_updateFoundValues(lua_State* L)
@@ -9314,14 +9484,17 @@ int CvLuaPlayer::lGetReplayData(lua_State* L)
 	{
 		lua_pushstring(L, pkPlayer->getReplayDataSetName(uiDataSet));
 
-		CvPlayer::TurnData data = pkPlayer->getReplayDataHistory(uiDataSet);
+		const CvPlayer::TurnValues& data = pkPlayer->getReplayDataHistory(uiDataSet);
 
 		lua_createtable(L, data.size() - 1, 1);
 
-		for(CvPlayer::TurnData::iterator it = data.begin(); it != data.end(); ++it)
+		for(unsigned int uiTurn = 0; uiTurn < data.size(); ++uiTurn)
 		{
-			lua_pushinteger(L, (*it).second);
-			lua_rawseti(L, -2, (*it).first);
+			if(data[uiTurn] == CvPlayer::REPLAY_DATA_NO_VALUE)
+				continue;
+
+			lua_pushinteger(L, data[uiTurn]);
+			lua_rawseti(L, -2, uiTurn);
 		}
 
 		lua_rawset(L, -3);
@@ -982,6 +982,11 @@ protected:
 	static int lGetNumUnitsNoCivlian(lua_State* L);
 #endif
 	static int lGetUnitByID(lua_State* L);
+#if defined(MOD_API_LUA_EXTENSIONS)
+	static int lGetSnapshot(lua_State* L);
+	static int lGetCitySnapshots(lua_State* L);
+	static int lGetUnitSnapshots(lua_State* L);
+#endif
 
 	static int lAI_updateFoundValues(lua_State* L);
 	static int lAI_foundValue(lua_State* L);
@@ -91,10 +91,21 @@ void CvLuaScopedIndirectInstance<Derived, InstanceType, EnumType>::Push(lua_Stat
 		lua_pushinteger(L, static_cast<int>(eID));
 		lua_setfield(L, -2, "__instance");
 
-		lua_createtable(L, 0, 1);			// create mt
-		lua_pushstring(L, "__index");
-		lua_pushvalue(L, type_index);
-		lua_rawset(L, -3);					// mt.__index = Type
+		//All instances of a type share one metatable (Type.__instancemt), created on first use.
+		lua_pushstring(L, "__instancemt");
+		lua_rawget(L, type_index);
+		if(lua_isnil(L, -1))
+		{
+			lua_pop(L, 1);
+			lua_createtable(L, 0, 1);			// create mt
+			lua_pushstring(L, "__index");
+			lua_pushvalue(L, type_index);
+			lua_rawset(L, -3);					// mt.__index = Type
+
+			lua_pushstring(L, "__instancemt");
+			lua_pushvalue(L, -2);
+			lua_rawset(L, type_index);			// Type.__instancemt = mt
+		}
 		lua_setmetatable(L, -2);
 
 		//Assign it in instances